@@ -0,0 +1,127 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "blockstatistics.h"
+
+#include <QTest>
+
+using Solid::Backends::Shared::BlockStatistics;
+
+// Exercises the parser on the stat formats of the kernel versions it meets:
+// 11 fields before 4.18, 15 with discards, 17 with flushes since 5.5.
+class BlockStatisticsTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testParse11();
+    void testParse15();
+    void testParse17();
+    void testParseInvalid_data();
+    void testParseInvalid();
+    void testParseInflight();
+};
+
+void BlockStatisticsTest::testParse11()
+{
+    Solid::Block::IoStatistics statistics;
+    QVERIFY(BlockStatistics::parseStat("    1200       30    96000     4000      800       20    64000     6000        2     5000    10000\n",
+                                       statistics));
+
+    QVERIFY(statistics.valid);
+    QCOMPARE(statistics.readsCompleted, Q_UINT64_C(1200));
+    QCOMPARE(statistics.readsMerged, Q_UINT64_C(30));
+    QCOMPARE(statistics.sectorsRead, Q_UINT64_C(96000));
+    QCOMPARE(statistics.readTime, Q_UINT64_C(4000));
+    QCOMPARE(statistics.writesCompleted, Q_UINT64_C(800));
+    QCOMPARE(statistics.writesMerged, Q_UINT64_C(20));
+    QCOMPARE(statistics.sectorsWritten, Q_UINT64_C(64000));
+    QCOMPARE(statistics.writeTime, Q_UINT64_C(6000));
+    QCOMPARE(statistics.inFlight, Q_UINT64_C(2));
+    QCOMPARE(statistics.ioTime, Q_UINT64_C(5000));
+    QCOMPARE(statistics.timeInQueue, Q_UINT64_C(10000));
+    QCOMPARE(statistics.discardsCompleted, Q_UINT64_C(0));
+    QCOMPARE(statistics.flushTime, Q_UINT64_C(0));
+}
+
+void BlockStatisticsTest::testParse15()
+{
+    Solid::Block::IoStatistics statistics;
+    QVERIFY(BlockStatistics::parseStat("1 2 3 4 5 6 7 8 9 10 11 12 13 14 15", statistics));
+
+    QCOMPARE(statistics.timeInQueue, Q_UINT64_C(11));
+    QCOMPARE(statistics.discardsCompleted, Q_UINT64_C(12));
+    QCOMPARE(statistics.discardsMerged, Q_UINT64_C(13));
+    QCOMPARE(statistics.sectorsDiscarded, Q_UINT64_C(14));
+    QCOMPARE(statistics.discardTime, Q_UINT64_C(15));
+    QCOMPARE(statistics.flushesCompleted, Q_UINT64_C(0));
+    QCOMPARE(statistics.flushTime, Q_UINT64_C(0));
+}
+
+void BlockStatisticsTest::testParse17()
+{
+    Solid::Block::IoStatistics statistics;
+    QVERIFY(BlockStatistics::parseStat("\t18446744073709551615 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17\n", statistics));
+
+    QCOMPARE(statistics.readsCompleted, Q_UINT64_C(18446744073709551615));
+    QCOMPARE(statistics.discardTime, Q_UINT64_C(15));
+    QCOMPARE(statistics.flushesCompleted, Q_UINT64_C(16));
+    QCOMPARE(statistics.flushTime, Q_UINT64_C(17));
+}
+
+void BlockStatisticsTest::testParseInvalid_data()
+{
+    QTest::addColumn<QByteArray>("stat");
+
+    QTest::newRow("empty") << QByteArray();
+    QTest::newRow("blank") << QByteArray("   \n");
+    QTest::newRow("too few fields") << QByteArray("1 2 3 4 5 6 7 8 9 10");
+    QTest::newRow("garbage") << QByteArray("not a stat file");
+    QTest::newRow("negative") << QByteArray("-1 2 3 4 5 6 7 8 9 10 11");
+    QTest::newRow("broken field") << QByteArray("1 2 3 4x 5 6 7 8 9 10 11");
+    QTest::newRow("cut short") << QByteArray("1 2 3 4 5\n6 7 8 9 10 11");
+}
+
+void BlockStatisticsTest::testParseInvalid()
+{
+    QFETCH(QByteArray, stat);
+
+    Solid::Block::IoStatistics statistics;
+    QVERIFY(!BlockStatistics::parseStat(stat, statistics));
+    QVERIFY(!statistics.valid);
+    QCOMPARE(statistics.readsCompleted, Q_UINT64_C(0));
+}
+
+void BlockStatisticsTest::testParseInflight()
+{
+    Solid::Block::IoStatistics statistics;
+    QVERIFY(BlockStatistics::parseInflight("       3        7\n", statistics));
+    QCOMPARE(statistics.readsInFlight, Q_UINT64_C(3));
+    QCOMPARE(statistics.writesInFlight, Q_UINT64_C(7));
+
+    Solid::Block::IoStatistics untouched;
+    QVERIFY(!BlockStatistics::parseInflight("3", untouched));
+    QVERIFY(!BlockStatistics::parseInflight(QByteArray(), untouched));
+    QCOMPARE(untouched.readsInFlight, Q_UINT64_C(0));
+}
+
+QTEST_GUILESS_MAIN(BlockStatisticsTest)
+
+#include "blockstatisticstest.moc"
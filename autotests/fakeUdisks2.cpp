@@ -0,0 +1,214 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fakeUdisks2.h"
+
+#include <QDBusConnection>
+#include <QDBusMessage>
+#include <QDBusMetaType>
+
+FakeUdisks2Manager::FakeUdisks2Manager(QObject *parent)
+    : QObject(parent)
+{
+    qDBusRegisterMetaType<QList<QDBusObjectPath> >();
+    qDBusRegisterMetaType<QVariantMap>();
+    qDBusRegisterMetaType<VariantMapMap>();
+    qDBusRegisterMetaType<DBUSManagerStruct>();
+}
+
+void FakeUdisks2Manager::registerService()
+{
+    QDBusConnection::systemBus().registerService(QStringLiteral(UD2_DBUS_SERVICE));
+    QDBusConnection::systemBus().registerObject(QStringLiteral(UD2_DBUS_PATH), this,
+                                                QDBusConnection::ExportAllSlots | QDBusConnection::ExportAllSignals);
+}
+
+void FakeUdisks2Manager::addBlockDevice(const QString &path)
+{
+    FakeUdisks2Block *block = new FakeUdisks2Block(QStringLiteral("/dev/") + path.section(QLatin1Char('/'), -1), this);
+    QDBusConnection::systemBus().registerObject(path, block, QDBusConnection::ExportAllProperties);
+
+    VariantMapMap interfaces;
+    interfaces.insert(QStringLiteral(UD2_DBUS_INTERFACE_BLOCK), block->properties());
+    m_objects.insert(QDBusObjectPath(path), interfaces);
+}
+
+void FakeUdisks2Manager::startJob(const QString &path, const QString &operation, const QString &object)
+{
+    FakeUdisks2Job *job = new FakeUdisks2Job(path, operation, object, this);
+    job->setObjectName(path);
+    QDBusConnection::systemBus().registerObject(path, job, QDBusConnection::ExportAllProperties);
+
+    VariantMapMap interfaces;
+    interfaces.insert(QStringLiteral(UD2_DBUS_INTERFACE_JOB), job->properties());
+    m_objects.insert(QDBusObjectPath(path), interfaces);
+
+    emit InterfacesAdded(QDBusObjectPath(path), interfaces);
+}
+
+void FakeUdisks2Manager::setJobProgress(const QString &path, double progress, qulonglong rate)
+{
+    FakeUdisks2Job *job = findChild<FakeUdisks2Job *>(path);
+    if (job) {
+        job->setProgress(progress, rate);
+    }
+}
+
+void FakeUdisks2Manager::finishJob(const QString &path)
+{
+    FakeUdisks2Job *job = findChild<FakeUdisks2Job *>(path);
+    if (!job) {
+        return;
+    }
+
+    m_objects.remove(QDBusObjectPath(path));
+    emit InterfacesRemoved(QDBusObjectPath(path), QStringList() << QStringLiteral(UD2_DBUS_INTERFACE_JOB));
+
+    QDBusConnection::systemBus().unregisterObject(path);
+    delete job;
+}
+
+DBUSManagerStruct FakeUdisks2Manager::GetManagedObjects()
+{
+    return m_objects;
+}
+
+FakeUdisks2Block::FakeUdisks2Block(const QString &device, QObject *parent)
+    : QObject(parent)
+    , m_device(device.toLatin1())
+{
+}
+
+QDBusObjectPath FakeUdisks2Block::drive() const
+{
+    return QDBusObjectPath("/");
+}
+
+QByteArray FakeUdisks2Block::device() const
+{
+    return m_device;
+}
+
+qulonglong FakeUdisks2Block::size() const
+{
+    return Q_UINT64_C(8589934592);
+}
+
+QString FakeUdisks2Block::idLabel() const
+{
+    return QStringLiteral("BACKUP");
+}
+
+QVariantMap FakeUdisks2Block::properties() const
+{
+    QVariantMap props;
+    props.insert(QStringLiteral("Drive"), QVariant::fromValue(drive()));
+    props.insert(QStringLiteral("Device"), device());
+    props.insert(QStringLiteral("Size"), size());
+    props.insert(QStringLiteral("IdLabel"), idLabel());
+    return props;
+}
+
+FakeUdisks2Job::FakeUdisks2Job(const QString &path, const QString &operation, const QString &object, QObject *parent)
+    : QObject(parent)
+    , m_path(path)
+    , m_operation(operation)
+    , m_object(object)
+    , m_progress(0.0)
+    , m_rate(0)
+{
+}
+
+QString FakeUdisks2Job::operation() const
+{
+    return m_operation;
+}
+
+double FakeUdisks2Job::progress() const
+{
+    return m_progress;
+}
+
+bool FakeUdisks2Job::progressValid() const
+{
+    return true;
+}
+
+qulonglong FakeUdisks2Job::bytes() const
+{
+    return Q_UINT64_C(1073741824);
+}
+
+qulonglong FakeUdisks2Job::rate() const
+{
+    return m_rate;
+}
+
+qulonglong FakeUdisks2Job::startTime() const
+{
+    return Q_UINT64_C(1500000000000000);
+}
+
+qulonglong FakeUdisks2Job::expectedEndTime() const
+{
+    return m_rate ? startTime() + bytes() * 1000000 / m_rate : 0;
+}
+
+QList<QDBusObjectPath> FakeUdisks2Job::objects() const
+{
+    return QList<QDBusObjectPath>() << QDBusObjectPath(m_object);
+}
+
+bool FakeUdisks2Job::cancelable() const
+{
+    return true;
+}
+
+void FakeUdisks2Job::setProgress(double progress, qulonglong rate)
+{
+    m_progress = progress;
+    m_rate = rate;
+
+    QVariantMap changed;
+    changed.insert(QStringLiteral("Progress"), m_progress);
+    changed.insert(QStringLiteral("Rate"), m_rate);
+    changed.insert(QStringLiteral("ExpectedEndTime"), expectedEndTime());
+
+    auto msg = QDBusMessage::createSignal(m_path,
+                                          QStringLiteral("org.freedesktop.DBus.Properties"),
+                                          QStringLiteral("PropertiesChanged"));
+    msg.setArguments(QList<QVariant>() << QStringLiteral(UD2_DBUS_INTERFACE_JOB) << changed << QStringList());
+    QDBusConnection::systemBus().send(msg);
+}
+
+QVariantMap FakeUdisks2Job::properties() const
+{
+    QVariantMap props;
+    props.insert(QStringLiteral("Operation"), operation());
+    props.insert(QStringLiteral("Progress"), progress());
+    props.insert(QStringLiteral("ProgressValid"), progressValid());
+    props.insert(QStringLiteral("Bytes"), bytes());
+    props.insert(QStringLiteral("Rate"), rate());
+    props.insert(QStringLiteral("StartTime"), startTime());
+    props.insert(QStringLiteral("ExpectedEndTime"), expectedEndTime());
+    props.insert(QStringLiteral("Objects"), QVariant::fromValue(objects()));
+    props.insert(QStringLiteral("Cancelable"), cancelable());
+    return props;
+}
@@ -0,0 +1,115 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_FAKE_UDISKS2_H
+#define SOLID_FAKE_UDISKS2_H
+
+#include <QList>
+#include <QString>
+#include <QDBusObjectPath>
+
+#include "udisks2.h"
+
+/* Just enough of the UDisks2 service to announce a block device and jobs working on it */
+class FakeUdisks2Manager : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.freedesktop.DBus.ObjectManager")
+public:
+    explicit FakeUdisks2Manager(QObject *parent);
+
+    void registerService();
+
+    void addBlockDevice(const QString &path);
+    void startJob(const QString &path, const QString &operation, const QString &object);
+    void setJobProgress(const QString &path, double progress, qulonglong rate);
+    void finishJob(const QString &path);
+
+public Q_SLOTS:
+    DBUSManagerStruct GetManagedObjects();
+
+Q_SIGNALS:
+    void InterfacesAdded(const QDBusObjectPath &object_path, const VariantMapMap &interfaces_and_properties);
+    void InterfacesRemoved(const QDBusObjectPath &object_path, const QStringList &interfaces);
+
+private:
+    DBUSManagerStruct m_objects;
+};
+
+class FakeUdisks2Block : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.freedesktop.UDisks2.Block")
+    Q_PROPERTY(QDBusObjectPath Drive READ drive)
+    Q_PROPERTY(QByteArray Device READ device)
+    Q_PROPERTY(qulonglong Size READ size)
+    Q_PROPERTY(QString IdLabel READ idLabel)
+public:
+    FakeUdisks2Block(const QString &device, QObject *parent);
+
+    QDBusObjectPath drive() const;
+    QByteArray device() const;
+    qulonglong size() const;
+    QString idLabel() const;
+
+    QVariantMap properties() const;
+
+private:
+    QByteArray m_device;
+};
+
+class FakeUdisks2Job : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.freedesktop.UDisks2.Job")
+    Q_PROPERTY(QString Operation READ operation)
+    Q_PROPERTY(double Progress READ progress)
+    Q_PROPERTY(bool ProgressValid READ progressValid)
+    Q_PROPERTY(qulonglong Bytes READ bytes)
+    Q_PROPERTY(qulonglong Rate READ rate)
+    Q_PROPERTY(qulonglong StartTime READ startTime)
+    Q_PROPERTY(qulonglong ExpectedEndTime READ expectedEndTime)
+    Q_PROPERTY(QList<QDBusObjectPath> Objects READ objects)
+    Q_PROPERTY(bool Cancelable READ cancelable)
+public:
+    FakeUdisks2Job(const QString &path, const QString &operation, const QString &object, QObject *parent);
+
+    QString operation() const;
+    double progress() const;
+    bool progressValid() const;
+    qulonglong bytes() const;
+    qulonglong rate() const;
+    qulonglong startTime() const;
+    qulonglong expectedEndTime() const;
+    QList<QDBusObjectPath> objects() const;
+    bool cancelable() const;
+
+    void setProgress(double progress, qulonglong rate);
+    QVariantMap properties() const;
+
+private:
+    QString m_path;
+    QString m_operation;
+    QString m_object;
+    double m_progress;
+    qulonglong m_rate;
+};
+
+#endif //SOLID_FAKE_UDISKS2_H
@@ -68,6 +68,20 @@ void FakeHardwareTest::testFakeBackend()
     instructionsets |= Solid::Processor::IntelSse;
     QCOMPARE(processor->instructionSets(), instructionsets);
 
+    QCOMPARE(processor->packageId(), 0);
+    QCOMPARE(processor->coreId(), 0);
+    QCOMPARE(processor->numaNode(), 0);
+    QCOMPARE(processor->packageSiblings(), QString("0-1"));
+
+    const Solid::Processor::CacheList caches = processor->caches();
+    QCOMPARE(caches.size(), 4);
+    QCOMPARE(caches.at(0).level, 1);
+    QCOMPARE(caches.at(0).type, Solid::Processor::DataCache);
+    QCOMPARE(caches.at(0).size, Q_UINT64_C(32768));
+    QCOMPARE(caches.at(0).lineSize, 64);
+    QCOMPARE(caches.at(3).level, 3);
+    QCOMPARE(caches.at(3).sharedCpus, QString("0-1"));
+
     delete processor;
     delete device;
     delete computer;
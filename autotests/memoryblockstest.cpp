@@ -0,0 +1,120 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "memoryblocks.h"
+
+#include <QTest>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+
+using Solid::Backends::Shared::MemoryBlocks;
+
+// Lists the blocks of a fake NUMA node directory laid out like sysfs, with
+// the memory_* entries recent kernels add next to the blocks.
+class MemoryBlocksTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+    void testList();
+    void testOnlineCount();
+    void testBlockName_data();
+    void testBlockName();
+
+private:
+    void addBlock(const QString &name, const QByteArray &online);
+
+    QTemporaryDir *m_node;
+};
+
+void MemoryBlocksTest::addBlock(const QString &name, const QByteArray &online)
+{
+    QVERIFY(QDir(m_node->path()).mkdir(name));
+    if (online.isNull()) {
+        return;
+    }
+    QFile file(m_node->path() + QLatin1Char('/') + name + QLatin1String("/online"));
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write(online + '\n');
+}
+
+void MemoryBlocksTest::init()
+{
+    m_node = new QTemporaryDir;
+    QVERIFY(m_node->isValid());
+
+    addBlock(QStringLiteral("memory0"), "1");
+    addBlock(QStringLiteral("memory1"), "0");
+    addBlock(QStringLiteral("memory32"), "1");
+    // not blocks, but matched by "memory*"
+    addBlock(QStringLiteral("memory_side_cache"), QByteArray());
+    addBlock(QStringLiteral("memory_failure"), QByteArray());
+    QFile file(m_node->path() + QLatin1String("/memory7"));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+}
+
+void MemoryBlocksTest::cleanup()
+{
+    delete m_node;
+    m_node = nullptr;
+}
+
+void MemoryBlocksTest::testList()
+{
+    QStringList blocks = MemoryBlocks::list(m_node->path());
+    blocks.sort();
+    QCOMPARE(blocks, QStringList() << QStringLiteral("memory0") << QStringLiteral("memory1") << QStringLiteral("memory32"));
+
+    QVERIFY(MemoryBlocks::list(m_node->path() + QLatin1String("/missing")).isEmpty());
+}
+
+void MemoryBlocksTest::testOnlineCount()
+{
+    QCOMPARE(MemoryBlocks::onlineCount(m_node->path()), 2);
+}
+
+void MemoryBlocksTest::testBlockName_data()
+{
+    QTest::addColumn<QString>("name");
+    QTest::addColumn<bool>("block");
+
+    QTest::newRow("first") << QStringLiteral("memory0") << true;
+    QTest::newRow("large") << QStringLiteral("memory4095") << true;
+    QTest::newRow("no number") << QStringLiteral("memory") << false;
+    QTest::newRow("side cache") << QStringLiteral("memory_side_cache") << false;
+    QTest::newRow("failure") << QStringLiteral("memory_failure") << false;
+    QTest::newRow("suffix") << QStringLiteral("memory12a") << false;
+    QTest::newRow("other") << QStringLiteral("cpu0") << false;
+}
+
+void MemoryBlocksTest::testBlockName()
+{
+    QFETCH(QString, name);
+    QFETCH(bool, block);
+
+    QCOMPARE(MemoryBlocks::isBlockName(name), block);
+}
+
+QTEST_GUILESS_MAIN(MemoryBlocksTest)
+
+#include "memoryblockstest.moc"
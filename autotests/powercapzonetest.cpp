@@ -0,0 +1,148 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "powercapzone.h"
+
+#include <QTest>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+
+using Solid::Backends::Shared::PowercapZone;
+
+// Exercises the reader on a fixture laid out like a powercap zone in sysfs,
+// since the real counters are only readable by root.
+class PowercapZoneTest : public QObject
+{
+    Q_OBJECT
+public:
+    PowercapZoneTest()
+        : m_zone(nullptr) {}
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+    void testAttributes();
+    void testEnergyDelta_data();
+    void testEnergyDelta();
+    void testWraparound();
+    void testUnreadable();
+
+private:
+    void writeAttribute(const char *name, const QByteArray &value);
+
+    QTemporaryDir *m_zone;
+};
+
+void PowercapZoneTest::writeAttribute(const char *name, const QByteArray &value)
+{
+    QFile file(m_zone->path() + QLatin1Char('/') + QLatin1String(name));
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write(value + '\n');
+}
+
+void PowercapZoneTest::init()
+{
+    m_zone = new QTemporaryDir;
+    QVERIFY(m_zone->isValid());
+
+    writeAttribute("name", "package-0");
+    writeAttribute("max_energy_range_uj", "1000000");
+    writeAttribute("energy_uj", "900000");
+}
+
+void PowercapZoneTest::cleanup()
+{
+    delete m_zone;
+    m_zone = nullptr;
+}
+
+void PowercapZoneTest::testAttributes()
+{
+    PowercapZone zone(m_zone->path());
+    QCOMPARE(zone.name(), QString("package-0"));
+    QCOMPARE(zone.domain(), Solid::EnergyCounter::Package);
+    QCOMPARE(zone.maxEnergyRange(), Q_UINT64_C(1000000));
+
+    QCOMPARE(PowercapZone::domainFromName("dram"), Solid::EnergyCounter::Dram);
+    QCOMPARE(PowercapZone::domainFromName("psys"), Solid::EnergyCounter::Platform);
+    QCOMPARE(PowercapZone::domainFromName("gpu"), Solid::EnergyCounter::UnknownDomain);
+}
+
+void PowercapZoneTest::testEnergyDelta_data()
+{
+    QTest::addColumn<qulonglong>("current");
+    QTest::addColumn<qulonglong>("previous");
+    QTest::addColumn<qulonglong>("range");
+    QTest::addColumn<qulonglong>("delta");
+
+    QTest::newRow("no change") << Q_UINT64_C(500) << Q_UINT64_C(500) << Q_UINT64_C(1000) << Q_UINT64_C(0);
+    QTest::newRow("increment") << Q_UINT64_C(700) << Q_UINT64_C(500) << Q_UINT64_C(1000) << Q_UINT64_C(200);
+    QTest::newRow("wrapped") << Q_UINT64_C(100) << Q_UINT64_C(900) << Q_UINT64_C(1000) << Q_UINT64_C(200);
+    QTest::newRow("wrapped to zero") << Q_UINT64_C(0) << Q_UINT64_C(1000) << Q_UINT64_C(1000) << Q_UINT64_C(0);
+    // a bogus range must not make the total jump by almost 2^64
+    QTest::newRow("beyond range") << Q_UINT64_C(100) << Q_UINT64_C(2000) << Q_UINT64_C(1000) << Q_UINT64_C(100);
+}
+
+void PowercapZoneTest::testEnergyDelta()
+{
+    QFETCH(qulonglong, current);
+    QFETCH(qulonglong, previous);
+    QFETCH(qulonglong, range);
+    QFETCH(qulonglong, delta);
+
+    QCOMPARE(PowercapZone::energyDelta(current, previous, range), delta);
+}
+
+void PowercapZoneTest::testWraparound()
+{
+    PowercapZone zone(m_zone->path());
+
+    // the first read is the origin
+    bool ok = false;
+    QCOMPARE(zone.energy(&ok), Q_UINT64_C(0));
+    QVERIFY(ok);
+
+    writeAttribute("energy_uj", "950000");
+    QCOMPARE(zone.energy(), Q_UINT64_C(50000));
+
+    // 50000 to the end of the range, then 200000 after the wrap
+    writeAttribute("energy_uj", "200000");
+    QCOMPARE(zone.energy(), Q_UINT64_C(300000));
+
+    writeAttribute("energy_uj", "800000");
+    QCOMPARE(zone.energy(), Q_UINT64_C(900000));
+
+    writeAttribute("energy_uj", "100000");
+    QCOMPARE(zone.energy(), Q_UINT64_C(1200000));
+}
+
+void PowercapZoneTest::testUnreadable()
+{
+    // like a zone whose counter is restricted to root
+    QVERIFY(QFile::remove(m_zone->path() + QLatin1String("/energy_uj")));
+    PowercapZone restricted(m_zone->path());
+    bool ok = true;
+    QCOMPARE(restricted.energy(&ok), Q_UINT64_C(0));
+    QVERIFY(!ok);
+}
+
+QTEST_GUILESS_MAIN(PowercapZoneTest)
+
+#include "powercapzonetest.moc"
@@ -0,0 +1,131 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "pressurestall.h"
+
+#include <QTest>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+
+using Solid::Backends::Shared::PressureStall;
+
+// Exercises the parser on the formats of /proc/pressure, and the reader on
+// a fixture file since PSI may be disabled on the test host.
+class PressureStallTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testParse();
+    void testParseSomeOnly();
+    void testParseInvalid();
+    void testTriggerSpec();
+    void testResourceFromName();
+    void testRead();
+};
+
+void PressureStallTest::testParse()
+{
+    Solid::Pressure::Stall some;
+    Solid::Pressure::Stall full;
+    QVERIFY(PressureStall::parse("some avg10=1.53 avg60=0.87 avg300=0.25 total=4213576\n"
+                                 "full avg10=0.40 avg60=0.11 avg300=0.03 total=1187304\n", &some, &full));
+
+    QCOMPARE(some.avg10, 1.53);
+    QCOMPARE(some.avg60, 0.87);
+    QCOMPARE(some.avg300, 0.25);
+    QCOMPARE(some.total, Q_UINT64_C(4213576));
+    QCOMPARE(full.avg10, 0.40);
+    QCOMPARE(full.avg60, 0.11);
+    QCOMPARE(full.avg300, 0.03);
+    QCOMPARE(full.total, Q_UINT64_C(1187304));
+}
+
+void PressureStallTest::testParseSomeOnly()
+{
+    // the cpu file of kernels before 5.13
+    Solid::Pressure::Stall some;
+    Solid::Pressure::Stall full;
+    full.total = 42;
+    QVERIFY(PressureStall::parse("some avg10=0.00 avg60=0.12 avg300=0.40 total=98765", &some, &full));
+    QCOMPARE(some.avg60, 0.12);
+    QCOMPARE(some.total, Q_UINT64_C(98765));
+    QCOMPARE(full.avg10, 0.0);
+    QCOMPARE(full.total, Q_UINT64_C(0));
+}
+
+void PressureStallTest::testParseInvalid()
+{
+    Solid::Pressure::Stall some;
+    Solid::Pressure::Stall full;
+    QVERIFY(!PressureStall::parse(QByteArray(), &some, &full));
+    QVERIFY(!PressureStall::parse("full avg10=0.40 avg60=0.11 avg300=0.03 total=1187304", &some, &full));
+    QVERIFY(!PressureStall::parse("some avg10 avg60=0.11", &some, &full));
+}
+
+void PressureStallTest::testTriggerSpec()
+{
+    QCOMPARE(PressureStall::triggerSpec(Solid::Pressure::Some, 150000, 1000000), QByteArray("some 150000 1000000"));
+    QCOMPARE(PressureStall::triggerSpec(Solid::Pressure::Full, 50000, 2000000), QByteArray("full 50000 2000000"));
+}
+
+void PressureStallTest::testResourceFromName()
+{
+    QCOMPARE(PressureStall::resourceFromName("cpu"), Solid::Pressure::Cpu);
+    QCOMPARE(PressureStall::resourceFromName("memory"), Solid::Pressure::Memory);
+    QCOMPARE(PressureStall::resourceFromName("io"), Solid::Pressure::Io);
+    QCOMPARE(PressureStall::resourceFromName("irq"), Solid::Pressure::UnknownResource);
+}
+
+void PressureStallTest::testRead()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.path() + QLatin1String("/io");
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("some avg10=2.00 avg60=1.00 avg300=0.50 total=300\n"
+               "full avg10=1.00 avg60=0.50 avg300=0.25 total=100\n");
+    file.close();
+
+    PressureStall stall(path);
+    Solid::Pressure::Stall some;
+    Solid::Pressure::Stall full;
+    QVERIFY(stall.read(&some, &full));
+    QCOMPARE(some.total, Q_UINT64_C(300));
+    QCOMPARE(full.avg10, 1.0);
+
+    // every read sees the current contents
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("some avg10=4.00 avg60=1.50 avg300=0.60 total=900\n");
+    file.close();
+    QVERIFY(stall.read(&some, &full));
+    QCOMPARE(some.avg10, 4.0);
+    QCOMPARE(some.total, Q_UINT64_C(900));
+
+    PressureStall missing(dir.path() + QLatin1String("/missing"));
+    QVERIFY(!missing.read(&some, &full));
+    QCOMPARE(missing.openTrigger(Solid::Pressure::Some, 150000, 1000000), -1);
+}
+
+QTEST_GUILESS_MAIN(PressureStallTest)
+
+#include "pressurestalltest.moc"
@@ -25,8 +25,20 @@
 #include <solid/devicenotifier.h>
 #include <solid/device.h>
 #include <solid/genericinterface.h>
+#include <solid/block.h>
+#include <solid/blockiosampler.h>
+#include <solid/networkinterface.h>
+#include <solid/networkinterfacesampler.h>
+#include <solid/sensor.h>
+#include <solid/sensorsampler.h>
+#include <solid/numanode.h>
+#include <solid/energycounter.h>
+#include <solid/energymeter.h>
+#include <solid/pressure.h>
 #include <solid/processor.h>
+#include <solid/processortelemetry.h>
 #include <solid/storageaccess.h>
+#include <solid/storagedrive.h>
 #include <solid/storagevolume.h>
 #include <solid/predicate.h>
 #include "solid/devices/managerbase_p.h"
@@ -280,6 +292,11 @@ void SolidHwTest::testDeviceInterfaceIntrospection_data()
     QTest::newRow("DeviceInterface: Camera") << "Camera" << (int)Solid::DeviceInterface::Camera;
     QTest::newRow("DeviceInterface: PortableMediaPlayer") << "PortableMediaPlayer" << (int)Solid::DeviceInterface::PortableMediaPlayer;
     QTest::newRow("DeviceInterface: Battery") << "Battery" << (int)Solid::DeviceInterface::Battery;
+    QTest::newRow("DeviceInterface: NetworkInterface") << "NetworkInterface" << (int)Solid::DeviceInterface::NetworkInterface;
+    QTest::newRow("DeviceInterface: Sensor") << "Sensor" << (int)Solid::DeviceInterface::Sensor;
+    QTest::newRow("DeviceInterface: NumaNode") << "NumaNode" << (int)Solid::DeviceInterface::NumaNode;
+    QTest::newRow("DeviceInterface: EnergyCounter") << "EnergyCounter" << (int)Solid::DeviceInterface::EnergyCounter;
+    QTest::newRow("DeviceInterface: Pressure") << "Pressure" << (int)Solid::DeviceInterface::Pressure;
 }
 
 void SolidHwTest::testDeviceInterfaceIntrospection()
@@ -369,6 +386,35 @@ void SolidHwTest::testPredicate()
     QCOMPARE(list.size(), 1);
     QCOMPARE(list.at(0).udi(), QString("/org/kde/solid/fakehw/acpi_CPU1"));
 
+    list = Solid::Device::listFromQuery("Processor.numaNode == 1");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), QString("/org/kde/solid/fakehw/acpi_CPU1"));
+
+    list = Solid::Device::listFromQuery("[Processor.packageId == 0 AND Processor.l3SharedCpus == '0-1']");
+    QCOMPARE(list.size(), 2);
+
+    list = Solid::Device::listFromQuery("Processor.l2CacheSize == 1048576");
+    QCOMPARE(list.size(), 2);
+
+    list = Solid::Device::listFromQuery("Processor.instructionSets & 'IntelAvx2|IntelAvx512F'");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), QString("/org/kde/solid/fakehw/acpi_CPU1"));
+
+    list = Solid::Device::listFromQuery("[Block.rotational == true AND Block.physicalBlockSize == 4096]");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), QString("/org/kde/solid/fakehw/storage_serial_HD56890I"));
+
+    list = Solid::Device::listFromQuery("[Block.rotational == false AND IS StorageDrive]");
+    QVERIFY(!list.isEmpty());
+    Q_FOREACH (const Solid::Device &device, list) {
+        QVERIFY(device.udi() != QLatin1String("/org/kde/solid/fakehw/storage_serial_HD56890I"));
+    }
+
+    list = Solid::Device::listFromQuery("Block.scheduler == 'bfq'");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).as<Solid::Block>()->zonedModel(), Solid::Block::NotZoned);
+    QCOMPARE(list.at(0).as<Solid::Block>()->readAheadSize(), 128);
+
 }
 
 void SolidHwTest::testQueryStorageVolumeOrProcessor()
@@ -447,6 +493,298 @@ void SolidHwTest::testListFromTypeProcessor()
     QCOMPARE(list.at(1).udi(), QString("/org/kde/solid/fakehw/acpi_CPU1"));
 }
 
+void SolidHwTest::testProcessorTelemetry()
+{
+    Solid::ProcessorTelemetry telemetry;
+
+    Solid::ProcessorTelemetry::SampleList samples = telemetry.sample();
+    QCOMPARE(samples.size(), 2);
+    QCOMPARE(samples.at(0).udi, QString("/org/kde/solid/fakehw/acpi_CPU0"));
+    QCOMPARE(samples.at(0).currentSpeed, 1800);
+    QCOMPARE(samples.at(0).maxSpeed, 3200);
+    QCOMPARE(samples.at(0).governor, QString("schedutil"));
+    QCOMPARE(samples.at(0).energyPerformancePreference, QString("balance_performance"));
+    QCOMPARE(samples.at(0).idleStates.size(), 3);
+    QCOMPARE(samples.at(0).idleStates.at(2).name, QString("C6"));
+    QCOMPARE(samples.at(0).idleStates.at(2).exitLatency, 170);
+    QCOMPARE(samples.at(0).idleTimeDelta, Q_UINT64_C(0));
+    QCOMPARE(samples.at(1).currentSpeed, 800);
+    QVERIFY(samples.at(1).idleStates.isEmpty());
+
+    QSignalSpy spy(&telemetry, SIGNAL(sampled(Solid::ProcessorTelemetry::SampleList)));
+    telemetry.setInterval(10);
+    telemetry.start();
+    QVERIFY(telemetry.isActive());
+    QVERIFY(spy.wait());
+    telemetry.stop();
+
+    samples = spy.first().first().value<Solid::ProcessorTelemetry::SampleList>();
+    QCOMPARE(samples.size(), 2);
+    // the fake counters don't move
+    QCOMPARE(samples.at(0).idleTimeDelta, Q_UINT64_C(0));
+}
+
+void SolidHwTest::testBlockIoSampler()
+{
+    const QString udi("/org/kde/solid/fakehw/storage_serial_HD56890I");
+    Solid::BlockIoSampler sampler(QList<Solid::Device>() << Solid::Device(udi)
+                                  << Solid::Device("/org/kde/solid/fakehw/acpi_CPU0"));
+
+    Solid::BlockIoSampler::SampleList samples = sampler.sample();
+    QCOMPARE(samples.size(), 1);
+    QCOMPARE(samples.at(0).udi, udi);
+    QCOMPARE(samples.at(0).device, QString("/dev/hda"));
+    QVERIFY(samples.at(0).statistics.valid);
+    QCOMPARE(samples.at(0).statistics.readsCompleted, Q_UINT64_C(1200));
+    QCOMPARE(samples.at(0).statistics.sectorsWritten, Q_UINT64_C(64000));
+    QCOMPARE(samples.at(0).statistics.inFlight, Q_UINT64_C(2));
+    QCOMPARE(samples.at(0).statistics.readsInFlight, Q_UINT64_C(1));
+    QCOMPARE(samples.at(0).statistics.discardsCompleted, Q_UINT64_C(0));
+    QCOMPARE(samples.at(0).interval, qint64(0));
+    QCOMPARE(samples.at(0).reads, Q_UINT64_C(0));
+
+    Solid::Backends::Fake::FakeDevice *fake = fakeManager->findDevice(udi);
+    fake->setProperty("ioStatistics", "1300 30 96800 4300 850 20 64400 6100 0 5010 10020");
+    QTest::qWait(20);
+
+    samples = sampler.sample();
+    QCOMPARE(samples.size(), 1);
+    QVERIFY(samples.at(0).interval >= 20);
+    QCOMPARE(samples.at(0).reads, Q_UINT64_C(100));
+    QCOMPARE(samples.at(0).writes, Q_UINT64_C(50));
+    QCOMPARE(samples.at(0).bytesRead, Q_UINT64_C(800 * 512));
+    QCOMPARE(samples.at(0).bytesWritten, Q_UINT64_C(400 * 512));
+    QVERIFY(samples.at(0).readsPerSecond > 0);
+    QVERIFY(samples.at(0).utilization > 0 && samples.at(0).utilization <= 1.0);
+    QCOMPARE(samples.at(0).averageReadLatency, 3.0);
+    QCOMPARE(samples.at(0).averageWriteLatency, 2.0);
+
+    // block devices without counters are still reported
+    Solid::Device floppy("/org/kde/solid/fakehw/platform_floppy_0_storage");
+    QVERIFY(!floppy.as<Solid::Block>()->ioStatistics().valid);
+}
+
+void SolidHwTest::testNetworkInterfaceSampler()
+{
+    const QString udi("/org/kde/solid/fakehw/net_00_11_22_33_44_55");
+
+    QList<Solid::Device> list = Solid::Device::listFromQuery("[NetworkInterface.carrier == true AND NetworkInterface.speed == 1000]");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), udi);
+    const Solid::NetworkInterface *iface = list.at(0).as<Solid::NetworkInterface>();
+    QCOMPARE(iface->interfaceName(), QString("eth0"));
+    QCOMPARE(iface->duplex(), Solid::NetworkInterface::FullDuplex);
+    QCOMPARE(iface->operationalState(), Solid::NetworkInterface::Up);
+    QCOMPARE(iface->mtu(), 1500);
+    QCOMPARE(iface->rxQueueCount(), 4);
+
+    Solid::NetworkInterfaceSampler sampler;
+    Solid::NetworkInterfaceSampler::SampleList samples = sampler.sample();
+    QCOMPARE(samples.size(), 1);
+    QCOMPARE(samples.at(0).udi, udi);
+    QCOMPARE(samples.at(0).speed, 1000);
+    QVERIFY(samples.at(0).statistics.valid);
+    QCOMPARE(samples.at(0).statistics.rxBytes, Q_UINT64_C(1000000));
+    QCOMPARE(samples.at(0).statistics.rxDropped, Q_UINT64_C(2));
+    QCOMPARE(samples.at(0).interval, qint64(0));
+
+    Solid::Backends::Fake::FakeDevice *fake = fakeManager->findDevice(udi);
+    fake->setProperty("statistics", "1250000 600000 1200 900 0 1 5 0 10 0");
+    QTest::qWait(20);
+
+    samples = sampler.sample();
+    QCOMPARE(samples.size(), 1);
+    QVERIFY(samples.at(0).interval >= 20);
+    QCOMPARE(samples.at(0).rxBytes, Q_UINT64_C(250000));
+    QCOMPARE(samples.at(0).txBytes, Q_UINT64_C(100000));
+    QCOMPARE(samples.at(0).rxPackets, Q_UINT64_C(200));
+    QCOMPARE(samples.at(0).rxDropped, Q_UINT64_C(3));
+    QCOMPARE(samples.at(0).txErrors, Q_UINT64_C(1));
+    QVERIFY(samples.at(0).rxBytesPerSecond > 0);
+    QVERIFY(samples.at(0).rxUtilization > 0 && samples.at(0).rxUtilization <= 1.0);
+}
+
+void SolidHwTest::testPcieLink()
+{
+    QList<Solid::Device> list = Solid::Device::listFromQuery("[IS NetworkInterface AND NetworkInterface.pcieLinkDegraded == true]");
+    QCOMPARE(list.size(), 1);
+    const Solid::NetworkInterface *iface = list.at(0).as<Solid::NetworkInterface>();
+    QCOMPARE(iface->pcieLinkSpeed(), 8.0);
+    QCOMPARE(iface->pcieLinkWidth(), 4);
+    QCOMPARE(iface->maxPcieLinkWidth(), 8);
+
+    list = Solid::Device::listFromQuery("StorageDrive.pcieLinkDegraded == true");
+    QCOMPARE(list.size(), 0);
+    list = Solid::Device::listFromQuery("StorageDrive.pcieLinkWidth == 1");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), QString("/org/kde/solid/fakehw/storage_serial_HD56890I"));
+    QVERIFY(!list.at(0).as<Solid::StorageDrive>()->isPcieLinkDegraded());
+
+    // drives without a PCI Express link are never degraded
+    Solid::Device floppy("/org/kde/solid/fakehw/platform_floppy_0_storage");
+    QCOMPARE(floppy.as<Solid::StorageDrive>()->pcieLinkSpeed(), 0.0);
+    QVERIFY(!floppy.as<Solid::StorageDrive>()->isPcieLinkDegraded());
+}
+
+void SolidHwTest::testSensorSampler()
+{
+    const QString udi("/org/kde/solid/fakehw/hwmon_coretemp");
+    const QString cpu0("/org/kde/solid/fakehw/acpi_CPU0");
+
+    QList<Solid::Device> list = Solid::Device::listFromQuery("Sensor.name == 'coretemp'");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), udi);
+    const Solid::Sensor *sensor = list.at(0).as<Solid::Sensor>();
+    QCOMPARE(sensor->name(), QString("coretemp"));
+    QCOMPARE(sensor->temperature(), 54.0);
+    const Solid::Sensor::ReadingList readings = sensor->readings();
+    QCOMPARE(readings.size(), 3);
+    QCOMPARE(readings.at(0).label, QString("Package id 0"));
+    QCOMPARE(readings.at(0).critical, 100.0);
+    QCOMPARE(readings.at(2).type, Solid::Sensor::Fan);
+    QCOMPARE(readings.at(2).value, 1450.0);
+
+    Solid::Device processor(cpu0);
+    QCOMPARE(processor.as<Solid::Processor>()->coreThrottleCount(), qlonglong(3));
+    QCOMPARE(Solid::Device("/org/kde/solid/fakehw/acpi_CPU1").as<Solid::Processor>()->coreThrottleCount(), qlonglong(-1));
+
+    Solid::SensorSampler sampler;
+    QSignalSpy spy(&sampler, SIGNAL(throttled(QString,qulonglong,qulonglong)));
+    Solid::SensorSampler::SampleList samples = sampler.sample();
+    QCOMPARE(samples.size(), 1);
+    QCOMPARE(samples.at(0).udi, udi);
+    QCOMPARE(samples.at(0).readings.size(), 3);
+    // the first sample only records the counters
+    QCOMPARE(spy.count(), 0);
+
+    sampler.sample();
+    QCOMPARE(spy.count(), 0);
+
+    Solid::Backends::Fake::FakeDevice *fake = fakeManager->findDevice(cpu0);
+    fake->setProperty("coreThrottleCount", 5);
+    sampler.sample();
+    QCOMPARE(spy.count(), 1);
+    const QList<QVariant> args = spy.takeFirst();
+    QCOMPARE(args.at(0).toString(), cpu0);
+    QCOMPARE(args.at(1).toULongLong(), Q_UINT64_C(2));
+    QCOMPARE(args.at(2).toULongLong(), Q_UINT64_C(0));
+}
+
+void SolidHwTest::testNumaNode()
+{
+    const QString udi("/org/kde/solid/fakehw/node_node0");
+
+    QList<Solid::Device> list = Solid::Device::listFromQuery("[NumaNode.number == 0 AND NumaNode.freeHugePages2M == 500]");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), udi);
+    Solid::NumaNode *node = list.at(0).as<Solid::NumaNode>();
+    QCOMPARE(node->cpuList(), QString("0-1"));
+    QCOMPARE(node->distances(), QList<int>() << 10 << 21);
+    QCOMPARE(node->totalMemory(), Q_UINT64_C(17179869184));
+    QCOMPARE(node->freeMemory(), Q_UINT64_C(8589934592));
+    QCOMPARE(node->hugePagePools().size(), 2);
+    QCOMPARE(node->hugePagePools().at(1).pageSize, Q_UINT64_C(1073741824));
+    QCOMPARE(node->totalHugePages2M(), 512);
+    QCOMPARE(node->freeHugePages1G(), 2);
+    QCOMPARE(node->onlineMemoryBlockCount(), 128);
+
+    QSignalSpy spy(node, SIGNAL(hugePagesChanged(QString)));
+    Solid::Backends::Fake::FakeDevice *fake = fakeManager->findDevice(udi);
+    fake->setProperty("hugePages", "2097152:512:256:0;1073741824:2:1:0");
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toString(), udi);
+    QCOMPARE(node->freeHugePages2M(), 256);
+    QCOMPARE(node->freeHugePages1G(), 1);
+}
+
+void SolidHwTest::testEnergyMeter()
+{
+    const QString package("/org/kde/solid/fakehw/powercap_intel_rapl_0");
+    const QString dram("/org/kde/solid/fakehw/powercap_intel_rapl_0_0");
+
+    QList<Solid::Device> list = Solid::Device::listFromQuery("EnergyCounter.domain == 'Dram'");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), dram);
+    QCOMPARE(list.at(0).as<Solid::EnergyCounter>()->name(), QString("dram"));
+
+    Solid::EnergyMeter meter;
+    QVERIFY(!meter.isActive());
+    meter.start();
+    QVERIFY(meter.isActive());
+
+    fakeManager->findDevice(package)->setProperty("energy", Q_UINT64_C(1025000000));
+    fakeManager->findDevice(dram)->setProperty("energy", Q_UINT64_C(202000000));
+    QTest::qWait(20);
+
+    const Solid::EnergyMeter::MeasurementList measurements = meter.stop();
+    QVERIFY(!meter.isActive());
+    QCOMPARE(measurements.size(), 2);
+    Q_FOREACH (const Solid::EnergyMeter::Measurement &measurement, measurements) {
+        QVERIFY(measurement.seconds >= 0.02);
+        QVERIFY(measurement.averageWatts > 0);
+        if (measurement.udi == package) {
+            QCOMPARE(measurement.domain, Solid::EnergyCounter::Package);
+            QCOMPARE(measurement.joules, 25.0);
+        } else {
+            QCOMPARE(measurement.udi, dram);
+            QCOMPARE(measurement.joules, 2.0);
+        }
+    }
+
+    // the result stays available after stop()
+    fakeManager->findDevice(package)->setProperty("energy", Q_UINT64_C(2000000000));
+    QCOMPARE(meter.measurements().size(), 2);
+    QCOMPARE(meter.measurements().at(0).joules, measurements.at(0).joules);
+}
+
+void SolidHwTest::testPressure()
+{
+    const QString udi("/org/kde/solid/fakehw/pressure_memory");
+
+    QList<Solid::Device> list = Solid::Device::listFromQuery("Pressure.resource == 'Memory'");
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).udi(), udi);
+
+    Solid::Pressure *pressure = list.at(0).as<Solid::Pressure>();
+    QVERIFY(pressure);
+    QCOMPARE(pressure->resource(), Solid::Pressure::Memory);
+    QCOMPARE(pressure->someAvg10(), 1.5);
+    QCOMPARE(pressure->some().avg300, 0.2);
+    QCOMPARE(pressure->some().total, Q_UINT64_C(4200000));
+    QCOMPARE(pressure->full().total, Q_UINT64_C(1100000));
+
+    // the kernel limits the window to between 500ms and 10s
+    QCOMPARE(pressure->addTrigger(Solid::Pressure::Some, 100000, 100000), -1);
+    QCOMPARE(pressure->addTrigger(Solid::Pressure::Some, 3000000, 2000000), -1);
+
+    const int someTrigger = pressure->addTrigger(Solid::Pressure::Some, 150000, 1000000);
+    const int fullTrigger = pressure->addTrigger(Solid::Pressure::Full, 100000, 2000000);
+    QVERIFY(someTrigger >= 0);
+    QVERIFY(fullTrigger >= 0);
+    QVERIFY(someTrigger != fullTrigger);
+
+    QSignalSpy spy(pressure, SIGNAL(triggered(int,QString)));
+
+    // below the threshold
+    fakeManager->findDevice(udi)->setProperty("some", "1.60:0.82:0.21:4300000");
+    QCOMPARE(spy.count(), 0);
+
+    fakeManager->findDevice(udi)->setProperty("some", "2.40:0.95:0.24:4400000");
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toInt(), someTrigger);
+    QCOMPARE(spy.at(0).at(1).toString(), udi);
+
+    fakeManager->findDevice(udi)->setProperty("full", "0.90:0.20:0.06:1250000");
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(spy.at(1).at(0).toInt(), fullTrigger);
+
+    // a removed trigger stays quiet
+    pressure->removeTrigger(someTrigger);
+    fakeManager->findDevice(udi)->setProperty("some", "5.00:1.50:0.40:6000000");
+    QCOMPARE(spy.count(), 2);
+    pressure->removeTrigger(fullTrigger);
+}
+
 void SolidHwTest::testListFromTypeInvalid()
 {
     const auto list = Solid::Device::listFromQuery("blup", QString());
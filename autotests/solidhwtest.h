@@ -55,6 +55,14 @@ private Q_SLOTS:
     void testQueryStorageVolumeOrStorageAccess();
     void testQueryWithParentUdi();
     void testListFromTypeProcessor();
+    void testProcessorTelemetry();
+    void testBlockIoSampler();
+    void testNetworkInterfaceSampler();
+    void testPcieLink();
+    void testSensorSampler();
+    void testNumaNode();
+    void testEnergyMeter();
+    void testPressure();
     void testListFromTypeInvalid();
     void testSetupTeardown();
 
@@ -0,0 +1,297 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "udevqtclient.h"
+#include "udevqt_p.h"
+
+#include <QTest>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QThread>
+#include <QtCore/QVector>
+
+static const char s_syspath[] = "/sys/devices/virtual/mem/null";
+
+// Feeds the client's monitor queue the way MonitorThread does, minus the
+// netlink socket, which cannot be written to without privileges. Like the
+// monitor, it creates the devices in a libudev context of its own.
+class StormThread : public QThread
+{
+public:
+    StormThread(UdevQt::ClientPrivate *client, int events, int batchSize)
+        : m_client(client), m_udev(udev_new()), m_events(events), m_batchSize(batchSize)
+    {
+    }
+
+    ~StormThread()
+    {
+        wait();
+        udev_unref(m_udev);
+    }
+
+protected:
+    void run() Q_DECL_OVERRIDE
+    {
+        int queued = 0;
+        while (queued < m_events) {
+            UdevQt::MonitorEvent *newest = nullptr;
+            UdevQt::MonitorEvent *oldest = nullptr;
+            for (int i = 0; i < m_batchSize && queued < m_events; ++i, ++queued) {
+                UdevQt::MonitorEvent *event = new UdevQt::MonitorEvent;
+                event->udev = udev_device_new_from_syspath(m_udev, s_syspath);
+                event->action = UdevQt::ActionChange;
+                event->next = newest;
+                newest = event;
+                if (!oldest) {
+                    oldest = event;
+                }
+            }
+            m_client->enqueueEvents(newest, oldest);
+        }
+    }
+
+private:
+    UdevQt::ClientPrivate *m_client;
+    struct udev *m_udev;
+    int m_events;
+    int m_batchSize;
+};
+
+// Pushes numbered chains straight into a MonitorQueue; the events are told
+// apart by their address, so the consumer must not free them before the end.
+class ProducerThread : public QThread
+{
+public:
+    ProducerThread(UdevQt::MonitorQueue *queue, int events, int batchSize)
+        : m_queue(queue), m_events(events), m_batchSize(batchSize)
+    {
+    }
+
+    QVector<UdevQt::MonitorEvent *> pushed;
+
+protected:
+    void run() Q_DECL_OVERRIDE
+    {
+        int queued = 0;
+        while (queued < m_events) {
+            UdevQt::MonitorEvent *newest = nullptr;
+            UdevQt::MonitorEvent *oldest = nullptr;
+            for (int i = 0; i < m_batchSize && queued < m_events; ++i, ++queued) {
+                UdevQt::MonitorEvent *event = new UdevQt::MonitorEvent;
+                event->udev = nullptr;
+                event->action = UdevQt::ActionChange;
+                event->next = newest;
+                newest = event;
+                if (!oldest) {
+                    oldest = event;
+                }
+                pushed << event;
+            }
+            m_queue->pushChain(newest, oldest);
+        }
+    }
+
+private:
+    UdevQt::MonitorQueue *m_queue;
+    int m_events;
+    int m_batchSize;
+};
+
+class UdevMonitorTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void testActionParsing();
+    void testBatchedDelivery_data();
+    void testBatchedDelivery();
+    void testMonitorQueue();
+    void testMonitorThread();
+};
+
+void UdevMonitorTest::initTestCase()
+{
+    if (!QFile::exists(QString::fromLatin1(s_syspath))) {
+        QSKIP("no sysfs to create udev devices from");
+    }
+}
+
+void UdevMonitorTest::testActionParsing()
+{
+    QCOMPARE(UdevQt::ClientPrivate::actionFromString("add"), UdevQt::ActionAdd);
+    QCOMPARE(UdevQt::ClientPrivate::actionFromString("remove"), UdevQt::ActionRemove);
+    QCOMPARE(UdevQt::ClientPrivate::actionFromString("change"), UdevQt::ActionChange);
+    QCOMPARE(UdevQt::ClientPrivate::actionFromString("online"), UdevQt::ActionOnline);
+    QCOMPARE(UdevQt::ClientPrivate::actionFromString("offline"), UdevQt::ActionOffline);
+    QCOMPARE(UdevQt::ClientPrivate::actionFromString("bind"), UdevQt::ActionUnknown);
+    QCOMPARE(UdevQt::ClientPrivate::actionFromString(nullptr), UdevQt::ActionUnknown);
+}
+
+void UdevMonitorTest::testBatchedDelivery_data()
+{
+    QTest::addColumn<int>("events");
+    QTest::addColumn<int>("batchSize");
+
+    QTest::newRow("one per wakeup") << 2000 << 1;
+    QTest::newRow("batched") << 20000 << 256;
+}
+
+void UdevMonitorTest::testBatchedDelivery()
+{
+    QFETCH(int, events);
+    QFETCH(int, batchSize);
+
+    UdevQt::Client client;
+    int received = 0;
+    bool intact = true;
+    connect(&client, &UdevQt::Client::deviceChanged, [&](const UdevQt::Device &dev) {
+        intact = intact && dev.sysfsPath() == QLatin1String(s_syspath);
+        ++received;
+    });
+
+    StormThread storm(UdevQt::ClientPrivate::get(&client), events, batchSize);
+    storm.start();
+    QTRY_COMPARE_WITH_TIMEOUT(received, events, 30000);
+    QVERIFY(storm.wait());
+    QVERIFY(intact);
+
+    const UdevQt::Client::MonitorStatistics stats = client.monitorStatistics();
+    QCOMPARE(stats.events, quint64(events));
+    // each wakeup of the main thread drains whatever has been queued so far
+    QVERIFY(stats.batches >= 1);
+    QVERIFY(stats.batches <= stats.events);
+
+    qDebug("%d events in %llu main thread wakeups: %.0f events/s, %.3f ms spent on the main thread",
+           events, stats.batches, stats.eventsPerSecond(), stats.mainThreadNsecs / 1e6);
+
+    client.resetMonitorStatistics();
+    QCOMPARE(client.monitorStatistics().events, quint64(0));
+}
+
+void UdevMonitorTest::testMonitorQueue()
+{
+    static const int producers = 4;
+    static const int events = 5000;
+
+    UdevQt::MonitorQueue queue;
+    QCOMPARE(queue.takeAll(), static_cast<UdevQt::MonitorEvent *>(nullptr));
+
+    QVector<ProducerThread *> threads;
+    for (int i = 0; i < producers; ++i) {
+        threads << new ProducerThread(&queue, events, 1 + i * 7);
+    }
+    Q_FOREACH (ProducerThread *thread, threads) {
+        thread->start();
+    }
+
+    // consume concurrently with the producers, like the client's thread does
+    QVector<UdevQt::MonitorEvent *> received;
+    QElapsedTimer timer;
+    timer.start();
+    while (received.size() < producers * events && timer.elapsed() < 30000) {
+        UdevQt::MonitorEvent *event = queue.takeAll();
+        if (!event) {
+            QThread::yieldCurrentThread();
+        }
+        for (; event; event = event->next) {
+            received << event;
+        }
+    }
+    QCOMPARE(received.size(), producers * events);
+
+    // every producer's events arrive exactly once and in the order they were pushed
+    QHash<UdevQt::MonitorEvent *, int> positions;
+    for (int i = 0; i < received.size(); ++i) {
+        positions.insert(received.at(i), i);
+    }
+    QCOMPARE(positions.size(), received.size());
+    Q_FOREACH (ProducerThread *thread, threads) {
+        QVERIFY(thread->wait());
+        int last = -1;
+        Q_FOREACH (UdevQt::MonitorEvent *event, thread->pushed) {
+            const int position = positions.value(event, -1);
+            QVERIFY(position > last);
+            last = position;
+        }
+    }
+
+    Q_FOREACH (UdevQt::MonitorEvent *event, received) {
+        delete event;
+    }
+    qDeleteAll(threads);
+}
+
+void UdevMonitorTest::testMonitorThread()
+{
+    UdevQt::Client client(QStringList() << QStringLiteral("mem"));
+    client.setMonitorMode(UdevQt::Client::ThreadedMonitor);
+    QCOMPARE(client.monitorMode(), UdevQt::Client::ThreadedMonitor);
+
+    UdevQt::ClientPrivate *d = UdevQt::ClientPrivate::get(&client);
+    if (!d->monitor) {
+        QSKIP("no udev monitor available");
+    }
+    QVERIFY(d->monitorThread);
+    QVERIFY(d->monitorThread->isRunning());
+    QVERIFY(!d->monitorNotifier);
+
+    // a real uevent takes the whole path: socket, monitor thread, queue, client thread.
+    // Triggering one needs privileges and a running udevd to relay it, and makes the
+    // host's udevd re-run its rules for the device, so it is only done on request
+    const QString uevent = QString::fromLatin1(s_syspath) + QStringLiteral("/uevent");
+    if (qgetenv("SOLID_UDEV_TEST_TRIGGER") == "1"
+            && QFileInfo(uevent).isWritable() && QFile::exists(QStringLiteral("/run/udev/control"))) {
+        int received = 0;
+        connect(&client, &UdevQt::Client::deviceChanged, [&](const UdevQt::Device &dev) {
+            if (dev.sysfsPath() == QLatin1String(s_syspath)) {
+                ++received;
+            }
+        });
+
+        QFile file(uevent);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QVERIFY(file.write("change") > 0);
+        file.close();
+
+        QTRY_VERIFY_WITH_TIMEOUT(received > 0, 10000);
+        QVERIFY(client.monitorStatistics().batches >= 1);
+    } else {
+        qDebug("not triggering a uevent (set SOLID_UDEV_TEST_TRIGGER=1 as root to do so), "
+               "only checking the monitor thread's life cycle");
+    }
+
+    // stopping must wake the thread out of poll() and join it
+    client.setMonitorMode(UdevQt::Client::NotifierMonitor);
+    QVERIFY(!d->monitorThread);
+    QVERIFY(d->monitorNotifier);
+
+    client.setMonitorMode(UdevQt::Client::ThreadedMonitor);
+    QVERIFY(d->monitorThread);
+    QVERIFY(d->monitorThread->isRunning());
+    client.setWatchedSubsystems(QStringList() << QStringLiteral("mem") << QStringLiteral("tty"));
+    QVERIFY(d->monitorThread);
+    QVERIFY(d->monitorThread->isRunning());
+}
+
+QTEST_GUILESS_MAIN(UdevMonitorTest)
+
+#include "udevmonitortest.moc"
@@ -0,0 +1,89 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "qtest_dbus.h"
+#include "fakeUdisks2.h"
+
+#include <QTest>
+#include <QSignalSpy>
+#include <Solid/Device>
+#include <Solid/GenericInterface>
+
+static const QString s_blockPath = QStringLiteral("/org/freedesktop/UDisks2/block_devices/sdz1");
+static const QString s_jobPath = QStringLiteral("/org/freedesktop/UDisks2/jobs/1");
+
+class Udisks2JobTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void testJobProgress();
+
+private:
+    FakeUdisks2Manager *m_fakeUdisks2;
+};
+
+void Udisks2JobTest::initTestCase()
+{
+    qRegisterMetaType<QMap<QString, int> >();
+
+    m_fakeUdisks2 = new FakeUdisks2Manager(this);
+    m_fakeUdisks2->addBlockDevice(s_blockPath);
+    m_fakeUdisks2->registerService();
+}
+
+void Udisks2JobTest::testJobProgress()
+{
+    Solid::Device device(s_blockPath);
+    QVERIFY(device.isValid());
+
+    Solid::GenericInterface *iface = device.as<Solid::GenericInterface>();
+    QVERIFY(iface);
+    QVERIFY(!iface->propertyExists(QStringLiteral("JobOperation")));
+
+    QSignalSpy spy(iface, SIGNAL(propertyChanged(QMap<QString,int>)));
+
+    m_fakeUdisks2->startJob(s_jobPath, QStringLiteral("filesystem-unmount"), s_blockPath);
+    QVERIFY(spy.wait(5000));
+    QCOMPARE(iface->property(QStringLiteral("JobOperation")).toString(), QStringLiteral("filesystem-unmount"));
+    QCOMPARE(iface->property(QStringLiteral("JobPath")).toString(), s_jobPath);
+    QCOMPARE(iface->property(QStringLiteral("JobBytes")).toULongLong(), Q_UINT64_C(1073741824));
+    QCOMPARE(iface->property(QStringLiteral("JobProgress")).toDouble(), 0.0);
+
+    spy.clear();
+    m_fakeUdisks2->setJobProgress(s_jobPath, 0.5, Q_UINT64_C(104857600));
+    QVERIFY(spy.wait(5000));
+    const QMap<QString, int> changes = spy.last().first().value<QMap<QString, int> >();
+    QVERIFY(changes.contains(QStringLiteral("JobProgress")));
+    QVERIFY(changes.contains(QStringLiteral("JobRate")));
+    QCOMPARE(iface->property(QStringLiteral("JobProgress")).toDouble(), 0.5);
+    QCOMPARE(iface->property(QStringLiteral("JobRate")).toULongLong(), Q_UINT64_C(104857600));
+    QCOMPARE(iface->property(QStringLiteral("JobExpectedEndTime")).toULongLong(), Q_UINT64_C(1500000000000000) + 10240000);
+
+    spy.clear();
+    m_fakeUdisks2->finishJob(s_jobPath);
+    QVERIFY(spy.wait(5000));
+    QVERIFY(!iface->propertyExists(QStringLiteral("JobOperation")));
+    QVERIFY(!iface->property(QStringLiteral("JobProgress")).isValid());
+}
+
+QTEST_GUILESS_MAIN_SYSTEM_DBUS(Udisks2JobTest)
+
+#include "udisks2jobtest.moc"
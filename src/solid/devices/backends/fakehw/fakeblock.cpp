@@ -19,8 +19,10 @@
 */
 
 #include "fakeblock.h"
+#include "../shared/blockstatistics.h"
 
 using namespace Solid::Backends::Fake;
+using Solid::Backends::Shared::BlockStatistics;
 
 FakeBlock::FakeBlock(FakeDevice *device)
     : FakeDeviceInterface(device)
@@ -48,3 +50,74 @@ QString FakeBlock::device() const
     return fakeDevice()->property("device").toString();
 }
 
+Solid::Block::IoStatistics FakeBlock::ioStatistics() const
+{
+    // "ioStatistics" holds the contents of the kernel's stat file, "inflight"
+    // those of the inflight file
+    Solid::Block::IoStatistics statistics;
+    if (BlockStatistics::parseStat(fakeDevice()->property("ioStatistics").toString().toLatin1(), statistics)) {
+        BlockStatistics::parseInflight(fakeDevice()->property("inflight").toString().toLatin1(), statistics);
+    }
+    return statistics;
+}
+
+bool FakeBlock::isRotational() const
+{
+    return fakeDevice()->property("rotational").toBool();
+}
+
+int FakeBlock::logicalBlockSize() const
+{
+    return fakeDevice()->property("logicalBlockSize").toInt();
+}
+
+int FakeBlock::physicalBlockSize() const
+{
+    return fakeDevice()->property("physicalBlockSize").toInt();
+}
+
+int FakeBlock::minimumIoSize() const
+{
+    return fakeDevice()->property("minimumIoSize").toInt();
+}
+
+int FakeBlock::optimalIoSize() const
+{
+    return fakeDevice()->property("optimalIoSize").toInt();
+}
+
+int FakeBlock::discardGranularity() const
+{
+    return fakeDevice()->property("discardGranularity").toInt();
+}
+
+Solid::Block::ZonedModel FakeBlock::zonedModel() const
+{
+    const QString zoned = fakeDevice()->property("zonedModel").toString();
+    if (zoned == "host-managed") {
+        return Solid::Block::HostManaged;
+    } else if (zoned == "host-aware") {
+        return Solid::Block::HostAware;
+    }
+    return Solid::Block::NotZoned;
+}
+
+QString FakeBlock::scheduler() const
+{
+    return fakeDevice()->property("scheduler").toString();
+}
+
+int FakeBlock::requestQueueSize() const
+{
+    return fakeDevice()->property("requestQueueSize").toInt();
+}
+
+int FakeBlock::readAheadSize() const
+{
+    return fakeDevice()->property("readAheadSize").toInt();
+}
+
+int FakeBlock::hardwareQueueCount() const
+{
+    return fakeDevice()->property("hardwareQueueCount").toInt();
+}
@@ -31,6 +31,11 @@
 #include "fakecamera.h"
 #include "fakeportablemediaplayer.h"
 #include "fakenetworkshare.h"
+#include "fakenetworkinterface.h"
+#include "fakesensor.h"
+#include "fakenumanode.h"
+#include "fakeenergycounter.h"
+#include "fakepressure.h"
 #include "fakebattery.h"
 
 #include <QtCore/QStringList>
@@ -119,6 +124,16 @@ QString FakeDevice::icon() const
         return "hdd-unmount";
     } else if (queryDeviceInterface(Solid::DeviceInterface::Block)) {
         return "blockdevice";
+    } else if (queryDeviceInterface(Solid::DeviceInterface::NetworkInterface)) {
+        return "network-wired";
+    } else if (queryDeviceInterface(Solid::DeviceInterface::Sensor)) {
+        return "temperature-normal";
+    } else if (queryDeviceInterface(Solid::DeviceInterface::NumaNode)) {
+        return "media-memory";
+    } else if (queryDeviceInterface(Solid::DeviceInterface::EnergyCounter)) {
+        return "battery-ac-adapter";
+    } else if (queryDeviceInterface(Solid::DeviceInterface::Pressure)) {
+        return "utilities-system-monitor";
     } else {
         return "hwinfo";
     }
@@ -297,6 +312,21 @@ QObject *FakeDevice::createDeviceInterface(const Solid::DeviceInterface::Type &t
     case Solid::DeviceInterface::NetworkShare:
         iface = new FakeNetworkShare(this);
         break;
+    case Solid::DeviceInterface::NetworkInterface:
+        iface = new FakeNetworkInterface(this);
+        break;
+    case Solid::DeviceInterface::Sensor:
+        iface = new FakeSensor(this);
+        break;
+    case Solid::DeviceInterface::NumaNode:
+        iface = new FakeNumaNode(this);
+        break;
+    case Solid::DeviceInterface::EnergyCounter:
+        iface = new FakeEnergyCounter(this);
+        break;
+    case Solid::DeviceInterface::Pressure:
+        iface = new FakePressure(this);
+        break;
     case Solid::DeviceInterface::Unknown:
         break;
     case Solid::DeviceInterface::Last:
@@ -0,0 +1,70 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fakeenergycounter.h"
+
+using namespace Solid::Backends::Fake;
+
+FakeEnergyCounter::FakeEnergyCounter(FakeDevice *device)
+    : FakeDeviceInterface(device)
+{
+}
+
+FakeEnergyCounter::~FakeEnergyCounter()
+{
+}
+
+QString FakeEnergyCounter::name() const
+{
+    return fakeDevice()->property("zoneName").toString();
+}
+
+Solid::EnergyCounter::Domain FakeEnergyCounter::domain() const
+{
+    const QString domain = fakeDevice()->property("domain").toString();
+    if (domain == "package") {
+        return Solid::EnergyCounter::Package;
+    } else if (domain == "core") {
+        return Solid::EnergyCounter::Core;
+    } else if (domain == "uncore") {
+        return Solid::EnergyCounter::Uncore;
+    } else if (domain == "dram") {
+        return Solid::EnergyCounter::Dram;
+    } else if (domain == "platform") {
+        return Solid::EnergyCounter::Platform;
+    }
+    return Solid::EnergyCounter::UnknownDomain;
+}
+
+qulonglong FakeEnergyCounter::maxEnergyRange() const
+{
+    return fakeDevice()->property("maxEnergyRange").toULongLong();
+}
+
+qulonglong FakeEnergyCounter::energy() const
+{
+    // the fake counter never wraps, it holds the corrected total
+    return fakeDevice()->property("energy").toULongLong();
+}
+
+bool FakeEnergyCounter::isReadable() const
+{
+    return fakeDevice()->property("energy").isValid();
+}
@@ -63,7 +63,12 @@ FakeManager::FakeManager(QObject *parent, const QString &xmlFile)
                            << Solid::DeviceInterface::Camera
                            << Solid::DeviceInterface::PortableMediaPlayer
                            << Solid::DeviceInterface::Battery
-                           << Solid::DeviceInterface::NetworkShare;
+                           << Solid::DeviceInterface::NetworkShare
+                           << Solid::DeviceInterface::NetworkInterface
+                           << Solid::DeviceInterface::Sensor
+                           << Solid::DeviceInterface::NumaNode
+                           << Solid::DeviceInterface::EnergyCounter
+                           << Solid::DeviceInterface::Pressure;
 }
 
 FakeManager::~FakeManager()
@@ -0,0 +1,150 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fakenetworkinterface.h"
+
+#include <QtCore/QStringList>
+
+using namespace Solid::Backends::Fake;
+
+FakeNetworkInterface::FakeNetworkInterface(FakeDevice *device)
+    : FakeDeviceInterface(device)
+{
+}
+
+FakeNetworkInterface::~FakeNetworkInterface()
+{
+}
+
+QString FakeNetworkInterface::interfaceName() const
+{
+    return fakeDevice()->property("interfaceName").toString();
+}
+
+QString FakeNetworkInterface::hardwareAddress() const
+{
+    return fakeDevice()->property("hardwareAddress").toString();
+}
+
+bool FakeNetworkInterface::isWireless() const
+{
+    return fakeDevice()->property("wireless").toBool();
+}
+
+int FakeNetworkInterface::speed() const
+{
+    const QVariant speed = fakeDevice()->property("speed");
+    return speed.isValid() ? speed.toInt() : -1;
+}
+
+Solid::NetworkInterface::Duplex FakeNetworkInterface::duplex() const
+{
+    const QString duplex = fakeDevice()->property("duplex").toString();
+    if (duplex == "full") {
+        return Solid::NetworkInterface::FullDuplex;
+    } else if (duplex == "half") {
+        return Solid::NetworkInterface::HalfDuplex;
+    }
+    return Solid::NetworkInterface::UnknownDuplex;
+}
+
+int FakeNetworkInterface::mtu() const
+{
+    return fakeDevice()->property("mtu").toInt();
+}
+
+bool FakeNetworkInterface::hasCarrier() const
+{
+    return fakeDevice()->property("carrier").toBool();
+}
+
+Solid::NetworkInterface::OperationalState FakeNetworkInterface::operationalState() const
+{
+    const QString state = fakeDevice()->property("operationalState").toString();
+    if (state == "up") {
+        return Solid::NetworkInterface::Up;
+    } else if (state == "down") {
+        return Solid::NetworkInterface::Down;
+    } else if (state == "lowerlayerdown") {
+        return Solid::NetworkInterface::LowerLayerDown;
+    } else if (state == "dormant") {
+        return Solid::NetworkInterface::Dormant;
+    } else if (state == "testing") {
+        return Solid::NetworkInterface::Testing;
+    } else if (state == "notpresent") {
+        return Solid::NetworkInterface::NotPresent;
+    }
+    return Solid::NetworkInterface::UnknownState;
+}
+
+int FakeNetworkInterface::rxQueueCount() const
+{
+    return fakeDevice()->property("rxQueueCount").toInt();
+}
+
+int FakeNetworkInterface::txQueueCount() const
+{
+    return fakeDevice()->property("txQueueCount").toInt();
+}
+
+Solid::NetworkInterface::Statistics FakeNetworkInterface::statistics() const
+{
+    // "statistics" holds rx/tx bytes, rx/tx packets, rx/tx errors,
+    // rx/tx dropped, multicast and collisions
+    Solid::NetworkInterface::Statistics statistics;
+
+    const QStringList counters = fakeDevice()->property("statistics").toString().split(' ', QString::SkipEmptyParts);
+    if (counters.size() != 10) {
+        return statistics;
+    }
+
+    statistics.valid = true;
+    statistics.rxBytes = counters.at(0).toULongLong();
+    statistics.txBytes = counters.at(1).toULongLong();
+    statistics.rxPackets = counters.at(2).toULongLong();
+    statistics.txPackets = counters.at(3).toULongLong();
+    statistics.rxErrors = counters.at(4).toULongLong();
+    statistics.txErrors = counters.at(5).toULongLong();
+    statistics.rxDropped = counters.at(6).toULongLong();
+    statistics.txDropped = counters.at(7).toULongLong();
+    statistics.multicast = counters.at(8).toULongLong();
+    statistics.collisions = counters.at(9).toULongLong();
+    return statistics;
+}
+
+double FakeNetworkInterface::pcieLinkSpeed() const
+{
+    return fakeDevice()->property("pcieLinkSpeed").toDouble();
+}
+
+int FakeNetworkInterface::pcieLinkWidth() const
+{
+    return fakeDevice()->property("pcieLinkWidth").toInt();
+}
+
+double FakeNetworkInterface::maxPcieLinkSpeed() const
+{
+    return fakeDevice()->property("maxPcieLinkSpeed").toDouble();
+}
+
+int FakeNetworkInterface::maxPcieLinkWidth() const
+{
+    return fakeDevice()->property("maxPcieLinkWidth").toInt();
+}
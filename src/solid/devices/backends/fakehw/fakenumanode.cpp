@@ -0,0 +1,105 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fakenumanode.h"
+
+#include <QtCore/QStringList>
+
+using namespace Solid::Backends::Fake;
+
+FakeNumaNode::FakeNumaNode(FakeDevice *device)
+    : FakeDeviceInterface(device)
+{
+    connect(device, SIGNAL(propertyChanged(QMap<QString,int>)),
+            this, SLOT(onPropertyChanged(QMap<QString,int>)));
+}
+
+FakeNumaNode::~FakeNumaNode()
+{
+}
+
+int FakeNumaNode::number() const
+{
+    return fakeDevice()->property("number").toInt();
+}
+
+QString FakeNumaNode::cpuList() const
+{
+    return fakeDevice()->property("cpuList").toString();
+}
+
+QList<int> FakeNumaNode::distances() const
+{
+    QList<int> distances;
+    Q_FOREACH (const QString &distance, fakeDevice()->property("distances").toString().split(' ', QString::SkipEmptyParts)) {
+        distances << distance.toInt();
+    }
+    return distances;
+}
+
+qulonglong FakeNumaNode::totalMemory() const
+{
+    return fakeDevice()->property("totalMemory").toULongLong();
+}
+
+qulonglong FakeNumaNode::freeMemory() const
+{
+    return fakeDevice()->property("freeMemory").toULongLong();
+}
+
+Solid::NumaNode::HugePagePoolList FakeNumaNode::hugePagePools() const
+{
+    // "hugePages" holds "pageSize:total:free:surplus" entries separated by
+    // semicolons, the page size being in bytes
+    Solid::NumaNode::HugePagePoolList pools;
+
+    const QStringList entries = fakeDevice()->property("hugePages").toString().split(';', QString::SkipEmptyParts);
+    Q_FOREACH (const QString &entry, entries) {
+        const QStringList fields = entry.trimmed().split(':');
+        if (fields.size() != 4) {
+            continue;
+        }
+
+        Solid::NumaNode::HugePagePool pool;
+        pool.pageSize = fields.at(0).toULongLong();
+        pool.total = fields.at(1).toInt();
+        pool.free = fields.at(2).toInt();
+        pool.surplus = fields.at(3).toInt();
+        pools << pool;
+    }
+    return pools;
+}
+
+int FakeNumaNode::memoryBlockCount() const
+{
+    return fakeDevice()->property("memoryBlockCount").toInt();
+}
+
+int FakeNumaNode::onlineMemoryBlockCount() const
+{
+    return fakeDevice()->property("onlineMemoryBlockCount").toInt();
+}
+
+void FakeNumaNode::onPropertyChanged(const QMap<QString, int> &changes)
+{
+    if (changes.contains(QStringLiteral("hugePages"))) {
+        emit hugePagesChanged(fakeDevice()->udi());
+    }
+}
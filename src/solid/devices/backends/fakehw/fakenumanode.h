@@ -0,0 +1,62 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_FAKEHW_FAKENUMANODE_H
+#define SOLID_BACKENDS_FAKEHW_FAKENUMANODE_H
+
+#include "fakedeviceinterface.h"
+#include <solid/devices/ifaces/numanode.h>
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Fake
+{
+class FakeNumaNode : public FakeDeviceInterface, public Solid::Ifaces::NumaNode
+{
+    Q_OBJECT
+    Q_INTERFACES(Solid::Ifaces::NumaNode)
+
+public:
+    explicit FakeNumaNode(FakeDevice *device);
+    ~FakeNumaNode();
+
+public Q_SLOTS:
+    int number() const Q_DECL_OVERRIDE;
+    QString cpuList() const Q_DECL_OVERRIDE;
+    QList<int> distances() const Q_DECL_OVERRIDE;
+    qulonglong totalMemory() const Q_DECL_OVERRIDE;
+    qulonglong freeMemory() const Q_DECL_OVERRIDE;
+    Solid::NumaNode::HugePagePoolList hugePagePools() const Q_DECL_OVERRIDE;
+    int memoryBlockCount() const Q_DECL_OVERRIDE;
+    int onlineMemoryBlockCount() const Q_DECL_OVERRIDE;
+
+Q_SIGNALS:
+    void hugePagesChanged(const QString &udi) Q_DECL_OVERRIDE;
+
+private Q_SLOTS:
+    void onPropertyChanged(const QMap<QString, int> &changes);
+};
+}
+}
+}
+
+#endif // SOLID_BACKENDS_FAKEHW_FAKENUMANODE_H
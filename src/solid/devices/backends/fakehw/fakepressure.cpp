@@ -0,0 +1,115 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fakepressure.h"
+
+#include <QtCore/QStringList>
+
+#include <algorithm>
+
+using namespace Solid::Backends::Fake;
+
+FakePressure::FakePressure(FakeDevice *device)
+    : FakeDeviceInterface(device)
+    , m_nextTrigger(0)
+{
+    connect(device, SIGNAL(propertyChanged(QMap<QString,int>)),
+            this, SLOT(onPropertyChanged(QMap<QString,int>)));
+}
+
+FakePressure::~FakePressure()
+{
+}
+
+Solid::Pressure::Resource FakePressure::resource() const
+{
+    const QString resource = fakeDevice()->property("resource").toString();
+    if (resource == "cpu") {
+        return Solid::Pressure::Cpu;
+    } else if (resource == "memory") {
+        return Solid::Pressure::Memory;
+    } else if (resource == "io") {
+        return Solid::Pressure::Io;
+    }
+    return Solid::Pressure::UnknownResource;
+}
+
+Solid::Pressure::Stall FakePressure::stall(Solid::Pressure::StallType type) const
+{
+    // "some" and "full" hold "avg10:avg60:avg300:total", total being in
+    // microseconds
+    const QString key = type == Solid::Pressure::Full ? "full" : "some";
+    const QStringList fields = fakeDevice()->property(key).toString().split(':');
+
+    Solid::Pressure::Stall stall;
+    if (fields.size() != 4) {
+        return stall;
+    }
+    stall.avg10 = fields.at(0).toDouble();
+    stall.avg60 = fields.at(1).toDouble();
+    stall.avg300 = fields.at(2).toDouble();
+    stall.total = fields.at(3).toULongLong();
+    return stall;
+}
+
+int FakePressure::addTrigger(Solid::Pressure::StallType type, qulonglong threshold, qulonglong window)
+{
+    // the limits the kernel enforces
+    if (window < 500000 || window > 10000000 || threshold == 0 || threshold > window) {
+        return -1;
+    }
+
+    Trigger trigger;
+    trigger.type = type;
+    trigger.threshold = threshold;
+    trigger.since = stall(type).total;
+
+    const int id = m_nextTrigger++;
+    m_triggers.insert(id, trigger);
+    return id;
+}
+
+void FakePressure::removeTrigger(int id)
+{
+    m_triggers.remove(id);
+}
+
+void FakePressure::onPropertyChanged(const QMap<QString, int> &changes)
+{
+    if (!changes.contains(QStringLiteral("some")) && !changes.contains(QStringLiteral("full"))) {
+        return;
+    }
+
+    // the window isn't emulated: a trigger fires once the stall time since
+    // it was registered or last fired reaches the threshold
+    QList<int> fired;
+    for (QHash<int, Trigger>::iterator it = m_triggers.begin(); it != m_triggers.end(); ++it) {
+        const qulonglong total = stall(it->type).total;
+        if (total >= it->since + it->threshold) {
+            it->since = total;
+            fired << it.key();
+        }
+    }
+
+    std::sort(fired.begin(), fired.end());
+    Q_FOREACH (int id, fired) {
+        emit triggered(id, fakeDevice()->udi());
+    }
+}
@@ -0,0 +1,71 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_FAKEHW_FAKEPRESSURE_H
+#define SOLID_BACKENDS_FAKEHW_FAKEPRESSURE_H
+
+#include "fakedeviceinterface.h"
+#include <solid/devices/ifaces/pressure.h>
+
+#include <QtCore/QHash>
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Fake
+{
+class FakePressure : public FakeDeviceInterface, public Solid::Ifaces::Pressure
+{
+    Q_OBJECT
+    Q_INTERFACES(Solid::Ifaces::Pressure)
+
+public:
+    explicit FakePressure(FakeDevice *device);
+    ~FakePressure();
+
+public Q_SLOTS:
+    Solid::Pressure::Resource resource() const Q_DECL_OVERRIDE;
+    Solid::Pressure::Stall stall(Solid::Pressure::StallType type) const Q_DECL_OVERRIDE;
+    int addTrigger(Solid::Pressure::StallType type, qulonglong threshold, qulonglong window) Q_DECL_OVERRIDE;
+    void removeTrigger(int id) Q_DECL_OVERRIDE;
+
+Q_SIGNALS:
+    void triggered(int id, const QString &udi) Q_DECL_OVERRIDE;
+
+private Q_SLOTS:
+    void onPropertyChanged(const QMap<QString, int> &changes);
+
+private:
+    struct Trigger {
+        Solid::Pressure::StallType type;
+        qulonglong threshold;
+        // the stall total when the trigger was registered or last fired
+        qulonglong since;
+    };
+
+    QHash<int, Trigger> m_triggers;
+    int m_nextTrigger;
+};
+}
+}
+}
+
+#endif // SOLID_BACKENDS_FAKEHW_FAKEPRESSURE_H
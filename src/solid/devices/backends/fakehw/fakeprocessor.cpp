@@ -65,12 +65,54 @@ Solid::Processor::InstructionSets FakeProcessor::instructionSets() const
             result |= Solid::Processor::IntelSse2;
         } else if (extension_str == "sse3") {
             result |= Solid::Processor::IntelSse3;
-        } else if (extension_str == "sse4") {
+        } else if (extension_str == "ssse3") {
+            result |= Solid::Processor::IntelSsse3;
+        } else if (extension_str == "sse4" || extension_str == "sse41") {
             result |= Solid::Processor::IntelSse4;
+        } else if (extension_str == "sse42") {
+            result |= Solid::Processor::IntelSse42;
         } else if (extension_str == "3dnow") {
             result |= Solid::Processor::Amd3DNow;
         } else if (extension_str == "altivec") {
             result |= Solid::Processor::AltiVec;
+        } else if (extension_str == "avx") {
+            result |= Solid::Processor::IntelAvx;
+        } else if (extension_str == "avx2") {
+            result |= Solid::Processor::IntelAvx2;
+        } else if (extension_str == "fma") {
+            result |= Solid::Processor::IntelFma;
+        } else if (extension_str == "f16c") {
+            result |= Solid::Processor::IntelF16c;
+        } else if (extension_str == "bmi1") {
+            result |= Solid::Processor::IntelBmi1;
+        } else if (extension_str == "bmi2") {
+            result |= Solid::Processor::IntelBmi2;
+        } else if (extension_str == "sha") {
+            result |= Solid::Processor::IntelSha;
+        } else if (extension_str == "vaes") {
+            result |= Solid::Processor::IntelVaes;
+        } else if (extension_str == "avx512f") {
+            result |= Solid::Processor::IntelAvx512F;
+        } else if (extension_str == "avx512cd") {
+            result |= Solid::Processor::IntelAvx512Cd;
+        } else if (extension_str == "avx512dq") {
+            result |= Solid::Processor::IntelAvx512Dq;
+        } else if (extension_str == "avx512bw") {
+            result |= Solid::Processor::IntelAvx512Bw;
+        } else if (extension_str == "avx512vl") {
+            result |= Solid::Processor::IntelAvx512Vl;
+        } else if (extension_str == "avx512vnni") {
+            result |= Solid::Processor::IntelAvx512Vnni;
+        } else if (extension_str == "avx512ifma") {
+            result |= Solid::Processor::IntelAvx512Ifma;
+        } else if (extension_str == "avx512vbmi") {
+            result |= Solid::Processor::IntelAvx512Vbmi;
+        } else if (extension_str == "amx-tile") {
+            result |= Solid::Processor::IntelAmxTile;
+        } else if (extension_str == "amx-bf16") {
+            result |= Solid::Processor::IntelAmxBf16;
+        } else if (extension_str == "amx-int8") {
+            result |= Solid::Processor::IntelAmxInt8;
         }
     }
 
@@ -78,3 +120,127 @@ Solid::Processor::InstructionSets FakeProcessor::instructionSets() const
 
 }
 
+int FakeProcessor::intProperty(const QString &key) const
+{
+    const QVariant value = fakeDevice()->property(key);
+    return value.isValid() ? value.toInt() : -1;
+}
+
+int FakeProcessor::packageId() const
+{
+    return intProperty("packageId");
+}
+
+int FakeProcessor::dieId() const
+{
+    return intProperty("dieId");
+}
+
+int FakeProcessor::coreId() const
+{
+    return intProperty("coreId");
+}
+
+int FakeProcessor::threadId() const
+{
+    return intProperty("threadId");
+}
+
+int FakeProcessor::numaNode() const
+{
+    return intProperty("numaNode");
+}
+
+QString FakeProcessor::threadSiblings() const
+{
+    return fakeDevice()->property("threadSiblings").toString();
+}
+
+QString FakeProcessor::packageSiblings() const
+{
+    return fakeDevice()->property("packageSiblings").toString();
+}
+
+Solid::Processor::CacheList FakeProcessor::caches() const
+{
+    // "level:type:size:lineSize:ways:sharedCpus" entries separated by ';',
+    // type being one of "data", "instruction" or "unified"
+    Solid::Processor::CacheList result;
+
+    const QString str = fakeDevice()->property("caches").toString();
+
+    Q_FOREACH (const QString &cache_str, str.split(';', QString::SkipEmptyParts)) {
+        const QStringList fields = cache_str.split(':');
+        if (fields.size() != 6) {
+            continue;
+        }
+
+        Solid::Processor::Cache cache;
+        cache.level = fields.at(0).toInt();
+        if (fields.at(1) == "data") {
+            cache.type = Solid::Processor::DataCache;
+        } else if (fields.at(1) == "instruction") {
+            cache.type = Solid::Processor::InstructionCache;
+        }
+        cache.size = fields.at(2).toULongLong();
+        cache.lineSize = fields.at(3).toInt();
+        cache.ways = fields.at(4).toInt();
+        cache.sharedCpus = fields.at(5);
+        result << cache;
+    }
+
+    return result;
+}
+
+int FakeProcessor::currentSpeed() const
+{
+    return fakeDevice()->property("currentSpeed").toInt();
+}
+
+QString FakeProcessor::governor() const
+{
+    return fakeDevice()->property("governor").toString();
+}
+
+QString FakeProcessor::energyPerformancePreference() const
+{
+    return fakeDevice()->property("energyPerformancePreference").toString();
+}
+
+Solid::Processor::IdleStateList FakeProcessor::idleStates() const
+{
+    // "name:exitLatency:targetResidency:time:usage" entries separated by ';'
+    Solid::Processor::IdleStateList result;
+
+    const QString str = fakeDevice()->property("idleStates").toString();
+
+    Q_FOREACH (const QString &state_str, str.split(';', QString::SkipEmptyParts)) {
+        const QStringList fields = state_str.split(':');
+        if (fields.size() != 5) {
+            continue;
+        }
+
+        Solid::Processor::IdleState state;
+        state.name = fields.at(0);
+        state.exitLatency = fields.at(1).toInt();
+        state.targetResidency = fields.at(2).toInt();
+        state.time = fields.at(3).toULongLong();
+        state.usage = fields.at(4).toULongLong();
+        result << state;
+    }
+
+    return result;
+}
+
+qlonglong FakeProcessor::coreThrottleCount() const
+{
+    const QVariant count = fakeDevice()->property("coreThrottleCount");
+    return count.isValid() ? count.toLongLong() : -1;
+}
+
+qlonglong FakeProcessor::packageThrottleCount() const
+{
+    const QVariant count = fakeDevice()->property("packageThrottleCount");
+    return count.isValid() ? count.toLongLong() : -1;
+}
+
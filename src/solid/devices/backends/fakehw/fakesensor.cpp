@@ -0,0 +1,80 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fakesensor.h"
+
+#include <QtCore/QStringList>
+
+using namespace Solid::Backends::Fake;
+
+FakeSensor::FakeSensor(FakeDevice *device)
+    : FakeDeviceInterface(device)
+{
+}
+
+FakeSensor::~FakeSensor()
+{
+}
+
+QString FakeSensor::name() const
+{
+    return fakeDevice()->property("sensorName").toString();
+}
+
+Solid::Sensor::ReadingList FakeSensor::readings() const
+{
+    // "readings" holds "type:label:value:maximum:critical" entries separated
+    // by semicolons, the type being the name of a Solid::Sensor::ReadingType
+    Solid::Sensor::ReadingList readings;
+
+    const QStringList entries = fakeDevice()->property("readings").toString().split(';', QString::SkipEmptyParts);
+    Q_FOREACH (const QString &entry, entries) {
+        const QStringList fields = entry.trimmed().split(':');
+        if (fields.size() != 5) {
+            continue;
+        }
+
+        Solid::Sensor::Reading reading;
+        const QString type = fields.at(0);
+        if (type == "Temperature") {
+            reading.type = Solid::Sensor::Temperature;
+        } else if (type == "Fan") {
+            reading.type = Solid::Sensor::Fan;
+        } else if (type == "Voltage") {
+            reading.type = Solid::Sensor::Voltage;
+        } else if (type == "Current") {
+            reading.type = Solid::Sensor::Current;
+        } else if (type == "Power") {
+            reading.type = Solid::Sensor::Power;
+        } else if (type == "Energy") {
+            reading.type = Solid::Sensor::Energy;
+        } else if (type == "Humidity") {
+            reading.type = Solid::Sensor::Humidity;
+        } else {
+            continue;
+        }
+        reading.label = fields.at(1);
+        reading.value = fields.at(2).toDouble();
+        reading.maximum = fields.at(3).toDouble();
+        reading.critical = fields.at(4).toDouble();
+        readings << reading;
+    }
+    return readings;
+}
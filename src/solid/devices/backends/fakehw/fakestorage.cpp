@@ -92,3 +92,22 @@ qulonglong FakeStorage::size() const
     return fakeDevice()->property("size").toULongLong();
 }
 
+double FakeStorage::pcieLinkSpeed() const
+{
+    return fakeDevice()->property("pcieLinkSpeed").toDouble();
+}
+
+int FakeStorage::pcieLinkWidth() const
+{
+    return fakeDevice()->property("pcieLinkWidth").toInt();
+}
+
+double FakeStorage::maxPcieLinkSpeed() const
+{
+    return fakeDevice()->property("maxPcieLinkSpeed").toDouble();
+}
+
+int FakeStorage::maxPcieLinkWidth() const
+{
+    return fakeDevice()->property("maxPcieLinkWidth").toInt();
+}
@@ -50,3 +50,64 @@ QString Block::device() const
     return m_device->prop("block.device").toString();
 }
 
+Solid::Block::IoStatistics Block::ioStatistics() const
+{
+    // HAL doesn't export I/O counters
+    return Solid::Block::IoStatistics();
+}
+
+// HAL doesn't export the request queue attributes
+bool Block::isRotational() const
+{
+    return false;
+}
+
+int Block::logicalBlockSize() const
+{
+    return 0;
+}
+
+int Block::physicalBlockSize() const
+{
+    return 0;
+}
+
+int Block::minimumIoSize() const
+{
+    return 0;
+}
+
+int Block::optimalIoSize() const
+{
+    return 0;
+}
+
+int Block::discardGranularity() const
+{
+    return 0;
+}
+
+Solid::Block::ZonedModel Block::zonedModel() const
+{
+    return Solid::Block::NotZoned;
+}
+
+QString Block::scheduler() const
+{
+    return QString();
+}
+
+int Block::requestQueueSize() const
+{
+    return 0;
+}
+
+int Block::readAheadSize() const
+{
+    return 0;
+}
+
+int Block::hardwareQueueCount() const
+{
+    return 0;
+}
@@ -445,6 +445,11 @@ QObject *HalDevice::createDeviceInterface(const Solid::DeviceInterface::Type &ty
         iface = new Battery(this);
         break;
     case Solid::DeviceInterface::NetworkShare:
+    case Solid::DeviceInterface::NetworkInterface:
+    case Solid::DeviceInterface::Sensor:
+    case Solid::DeviceInterface::NumaNode:
+    case Solid::DeviceInterface::EnergyCounter:
+    case Solid::DeviceInterface::Pressure:
         break;
     case Solid::DeviceInterface::Unknown:
     case Solid::DeviceInterface::Last:
@@ -87,6 +87,15 @@ public:
         case Solid::DeviceInterface::NetworkShare:
             list << "networkshare";
             break;
+        case Solid::DeviceInterface::NetworkInterface:
+            // HAL's "net" capability isn't supported by this backend
+            break;
+        case Solid::DeviceInterface::Sensor:
+        case Solid::DeviceInterface::NumaNode:
+        case Solid::DeviceInterface::EnergyCounter:
+        case Solid::DeviceInterface::Pressure:
+            // Doesn't exist with HAL
+            break;
         case Solid::DeviceInterface::Unknown:
             break;
         case Solid::DeviceInterface::Last:
@@ -59,3 +59,73 @@ Solid::Processor::InstructionSets Processor::instructionSets() const
     return cpuextensions;
 }
 
+int Processor::packageId() const
+{
+    return -1;
+}
+
+int Processor::dieId() const
+{
+    return -1;
+}
+
+int Processor::coreId() const
+{
+    return -1;
+}
+
+int Processor::threadId() const
+{
+    return -1;
+}
+
+int Processor::numaNode() const
+{
+    return -1;
+}
+
+QString Processor::threadSiblings() const
+{
+    return QString();
+}
+
+QString Processor::packageSiblings() const
+{
+    return QString();
+}
+
+Solid::Processor::CacheList Processor::caches() const
+{
+    return Solid::Processor::CacheList();
+}
+
+int Processor::currentSpeed() const
+{
+    return 0;
+}
+
+QString Processor::governor() const
+{
+    return QString();
+}
+
+QString Processor::energyPerformancePreference() const
+{
+    return QString();
+}
+
+Solid::Processor::IdleStateList Processor::idleStates() const
+{
+    return Solid::Processor::IdleStateList();
+}
+
+qlonglong Processor::coreThrottleCount() const
+{
+    return -1;
+}
+
+qlonglong Processor::packageThrottleCount() const
+{
+    return -1;
+}
+
@@ -45,6 +45,21 @@ public:
     int maxSpeed() const Q_DECL_OVERRIDE;
     bool canChangeFrequency() const Q_DECL_OVERRIDE;
     Solid::Processor::InstructionSets instructionSets() const Q_DECL_OVERRIDE;
+    // HAL has no notion of topology or caches
+    int packageId() const Q_DECL_OVERRIDE;
+    int dieId() const Q_DECL_OVERRIDE;
+    int coreId() const Q_DECL_OVERRIDE;
+    int threadId() const Q_DECL_OVERRIDE;
+    int numaNode() const Q_DECL_OVERRIDE;
+    QString threadSiblings() const Q_DECL_OVERRIDE;
+    QString packageSiblings() const Q_DECL_OVERRIDE;
+    Solid::Processor::CacheList caches() const Q_DECL_OVERRIDE;
+    int currentSpeed() const Q_DECL_OVERRIDE;
+    QString governor() const Q_DECL_OVERRIDE;
+    QString energyPerformancePreference() const Q_DECL_OVERRIDE;
+    Solid::Processor::IdleStateList idleStates() const Q_DECL_OVERRIDE;
+    qlonglong coreThrottleCount() const Q_DECL_OVERRIDE;
+    qlonglong packageThrottleCount() const Q_DECL_OVERRIDE;
 };
 }
 }
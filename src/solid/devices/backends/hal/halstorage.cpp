@@ -92,3 +92,24 @@ qulonglong Storage::size() const
     return m_device->prop("storage.size").toULongLong();
 }
 
+// HAL predates the pci.link properties, there is nothing to map them from
+
+double Storage::pcieLinkSpeed() const
+{
+    return 0;
+}
+
+int Storage::pcieLinkWidth() const
+{
+    return 0;
+}
+
+double Storage::maxPcieLinkSpeed() const
+{
+    return 0;
+}
+
+int Storage::maxPcieLinkWidth() const
+{
+    return 0;
+}
@@ -45,6 +45,10 @@ public:
     bool isRemovable() const Q_DECL_OVERRIDE;
     bool isHotpluggable() const Q_DECL_OVERRIDE;
     qulonglong size() const Q_DECL_OVERRIDE;
+    double pcieLinkSpeed() const Q_DECL_OVERRIDE;
+    int pcieLinkWidth() const Q_DECL_OVERRIDE;
+    double maxPcieLinkSpeed() const Q_DECL_OVERRIDE;
+    int maxPcieLinkWidth() const Q_DECL_OVERRIDE;
 };
 }
 }
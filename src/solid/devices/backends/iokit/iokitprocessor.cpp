@@ -56,3 +56,73 @@ Solid::Processor::InstructionSets Processor::instructionSets() const
     return 0; // TODO
 }
 
+int Processor::packageId() const
+{
+    return -1; // TODO
+}
+
+int Processor::dieId() const
+{
+    return -1; // TODO
+}
+
+int Processor::coreId() const
+{
+    return -1; // TODO
+}
+
+int Processor::threadId() const
+{
+    return -1; // TODO
+}
+
+int Processor::numaNode() const
+{
+    return -1; // TODO
+}
+
+QString Processor::threadSiblings() const
+{
+    return QString(); // TODO
+}
+
+QString Processor::packageSiblings() const
+{
+    return QString(); // TODO
+}
+
+Solid::Processor::CacheList Processor::caches() const
+{
+    return Solid::Processor::CacheList(); // TODO
+}
+
+int Processor::currentSpeed() const
+{
+    return 0; // TODO
+}
+
+QString Processor::governor() const
+{
+    return QString(); // TODO
+}
+
+QString Processor::energyPerformancePreference() const
+{
+    return QString(); // TODO
+}
+
+Solid::Processor::IdleStateList Processor::idleStates() const
+{
+    return Solid::Processor::IdleStateList(); // TODO
+}
+
+qlonglong Processor::coreThrottleCount() const
+{
+    return -1; // TODO
+}
+
+qlonglong Processor::packageThrottleCount() const
+{
+    return -1; // TODO
+}
+
@@ -0,0 +1,125 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "blockqueue.h"
+#include "sysfsfile.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+
+using namespace Solid::Backends::Shared;
+
+BlockQueue::BlockQueue(int major, int minor)
+{
+    const QFileInfo device(QString::fromLatin1("/sys/dev/block/%1:%2").arg(major).arg(minor));
+    m_diskPath = device.canonicalFilePath();
+    if (!m_diskPath.isEmpty() && QFileInfo::exists(m_diskPath + QLatin1String("/partition"))) {
+        m_diskPath = QFileInfo(m_diskPath).path();
+    }
+}
+
+QByteArray BlockQueue::attribute(const char *name) const
+{
+    if (m_diskPath.isEmpty()) {
+        return QByteArray();
+    }
+    SysfsFile file(m_diskPath + QLatin1String("/queue/") + QLatin1String(name));
+    return file.read();
+}
+
+int BlockQueue::intAttribute(const char *name) const
+{
+    return attribute(name).toInt();
+}
+
+bool BlockQueue::isRotational() const
+{
+    return attribute("rotational") == "1";
+}
+
+int BlockQueue::logicalBlockSize() const
+{
+    return intAttribute("logical_block_size");
+}
+
+int BlockQueue::physicalBlockSize() const
+{
+    return intAttribute("physical_block_size");
+}
+
+int BlockQueue::minimumIoSize() const
+{
+    return intAttribute("minimum_io_size");
+}
+
+int BlockQueue::optimalIoSize() const
+{
+    return intAttribute("optimal_io_size");
+}
+
+int BlockQueue::discardGranularity() const
+{
+    return intAttribute("discard_granularity");
+}
+
+Solid::Block::ZonedModel BlockQueue::zonedModel() const
+{
+    const QByteArray zoned = attribute("zoned");
+    if (zoned == "host-managed") {
+        return Solid::Block::HostManaged;
+    } else if (zoned == "host-aware") {
+        return Solid::Block::HostAware;
+    }
+    return Solid::Block::NotZoned;
+}
+
+QString BlockQueue::scheduler() const
+{
+    // lists the available schedulers with the active one in brackets, e.g.
+    // "mq-deadline kyber [bfq] none"; devices without a choice just say "none"
+    const QByteArray schedulers = attribute("scheduler");
+    const int start = schedulers.indexOf('[');
+    if (start >= 0) {
+        const int end = schedulers.indexOf(']', start);
+        if (end > start) {
+            return QString::fromLatin1(schedulers.mid(start + 1, end - start - 1));
+        }
+    }
+    return QString::fromLatin1(schedulers);
+}
+
+int BlockQueue::requestQueueSize() const
+{
+    return intAttribute("nr_requests");
+}
+
+int BlockQueue::readAheadSize() const
+{
+    return intAttribute("read_ahead_kb");
+}
+
+int BlockQueue::hardwareQueueCount() const
+{
+    if (m_diskPath.isEmpty()) {
+        return 0;
+    }
+    // one directory per hardware context of a blk-mq device
+    return QDir(m_diskPath + QLatin1String("/mq")).entryList(QDir::Dirs | QDir::NoDotAndDotDot).count();
+}
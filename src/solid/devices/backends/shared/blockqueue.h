@@ -0,0 +1,70 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_SHARED_BLOCKQUEUE_H
+#define SOLID_BACKENDS_SHARED_BLOCKQUEUE_H
+
+#include <solid/block.h>
+
+#include <QtCore/QString>
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Shared
+{
+
+/**
+ * Reads the request queue attributes of a block device from sysfs.
+ *
+ * Partitions have no queue of their own, their disk's queue is used instead.
+ * The attributes are read on every call since several of them can be tuned
+ * at runtime.
+ */
+class BlockQueue
+{
+public:
+    BlockQueue(int major, int minor);
+
+    bool isRotational() const;
+    int logicalBlockSize() const;
+    int physicalBlockSize() const;
+    int minimumIoSize() const;
+    int optimalIoSize() const;
+    int discardGranularity() const;
+    Solid::Block::ZonedModel zonedModel() const;
+    QString scheduler() const;
+    int requestQueueSize() const;
+    int readAheadSize() const;
+    int hardwareQueueCount() const;
+
+private:
+    QByteArray attribute(const char *name) const;
+    int intAttribute(const char *name) const;
+
+    QString m_diskPath;
+};
+
+}
+}
+}
+
+#endif // SOLID_BACKENDS_SHARED_BLOCKQUEUE_H
@@ -0,0 +1,71 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_SHARED_BLOCKSTATISTICS_H
+#define SOLID_BACKENDS_SHARED_BLOCKSTATISTICS_H
+
+#include <solid/block.h>
+
+#include "sysfsfile.h"
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Shared
+{
+
+/**
+ * Reads the I/O counters of a block device from the kernel's stat and
+ * inflight attributes, addressed by device number so that it works the same
+ * for whole disks and partitions.
+ *
+ * Both files stay open between reads, so a sample costs two pread() calls.
+ */
+class BlockStatistics
+{
+public:
+    BlockStatistics(int major, int minor);
+
+    Solid::Block::IoStatistics read();
+
+    /**
+     * Parses the contents of a stat attribute, which holds 11, 15 or 17
+     * counters depending on the kernel version.
+     */
+    static bool parseStat(const QByteArray &stat, Solid::Block::IoStatistics &statistics);
+    /**
+     * Parses the contents of an inflight attribute: the reads and the writes
+     * in flight.
+     */
+    static bool parseInflight(const QByteArray &inflight, Solid::Block::IoStatistics &statistics);
+
+private:
+    Q_DISABLE_COPY(BlockStatistics)
+
+    SysfsFile m_stat;
+    SysfsFile m_inflight;
+};
+
+}
+}
+}
+
+#endif // SOLID_BACKENDS_SHARED_BLOCKSTATISTICS_H
@@ -0,0 +1,92 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "blockstatistics.h"
+
+// The parsers are kept apart from the sysfs reader, so that backends without
+// sysfs, like the fake one, can share them.
+
+using namespace Solid::Backends::Shared;
+
+// splits a line of unsigned decimal numbers without allocating
+static int parseCounters(const QByteArray &line, qulonglong *counters, int max)
+{
+    int count = 0;
+    const char *p = line.constData();
+    const char *end = p + line.size();
+
+    while (p < end && count < max) {
+        while (p < end && (*p == ' ' || *p == '\t')) {
+            ++p;
+        }
+        if (p == end || *p < '0' || *p > '9') {
+            break;
+        }
+        qulonglong value = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            value = value * 10 + (*p - '0');
+            ++p;
+        }
+        counters[count++] = value;
+    }
+    return count;
+}
+
+bool BlockStatistics::parseStat(const QByteArray &stat, Solid::Block::IoStatistics &statistics)
+{
+    qulonglong c[17] = {};
+    const int count = parseCounters(stat, c, 17);
+    if (count < 11) {
+        return false;
+    }
+
+    statistics.valid = true;
+    statistics.readsCompleted = c[0];
+    statistics.readsMerged = c[1];
+    statistics.sectorsRead = c[2];
+    statistics.readTime = c[3];
+    statistics.writesCompleted = c[4];
+    statistics.writesMerged = c[5];
+    statistics.sectorsWritten = c[6];
+    statistics.writeTime = c[7];
+    statistics.inFlight = c[8];
+    statistics.ioTime = c[9];
+    statistics.timeInQueue = c[10];
+    // 4.18 added discards, 5.5 flushes; missing fields stay 0
+    statistics.discardsCompleted = c[11];
+    statistics.discardsMerged = c[12];
+    statistics.sectorsDiscarded = c[13];
+    statistics.discardTime = c[14];
+    statistics.flushesCompleted = c[15];
+    statistics.flushTime = c[16];
+    return true;
+}
+
+bool BlockStatistics::parseInflight(const QByteArray &inflight, Solid::Block::IoStatistics &statistics)
+{
+    qulonglong c[2];
+    if (parseCounters(inflight, c, 2) != 2) {
+        return false;
+    }
+
+    statistics.readsInFlight = c[0];
+    statistics.writesInFlight = c[1];
+    return true;
+}
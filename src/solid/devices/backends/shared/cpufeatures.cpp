@@ -21,18 +21,19 @@
 
 #include "cpufeatures.h"
 
-#ifndef _MSC_VER
-//for cpuFeatures
-#include <csignal>
-#include <csetjmp>
-#else
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
 #include <intrin.h>
+#  define SOLID_X86_CPUID
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#include <cpuid.h>
+#  define SOLID_X86_CPUID
 #endif
-#include <config-processor.h>
 
-#if defined(__GNUC__) || defined(__INTEL_COMPILER)
-#  define HAVE_GNU_INLINE_ASM
+#ifdef __PPC__
+#include <csignal>
+#include <csetjmp>
 #endif
+#include <config-processor.h>
 
 namespace Solid
 {
@@ -41,43 +42,186 @@ namespace Backends
 namespace Shared
 {
 
-#ifndef _MSC_VER
-typedef void (*kde_sighandler_t)(int);
-
-#if defined( __i386__ ) || defined( __x86_64__ )
-static jmp_buf env;
+#ifdef SOLID_X86_CPUID
+namespace
+{
+struct CpuidRegs {
+    unsigned int eax, ebx, ecx, edx;
+};
 
-#ifdef HAVE_X86_SSE
-// Sighandler for the SSE OS support check
-static void sighandler(int)
+// returns false if @p leaf is beyond what the processor implements
+bool cpuid(unsigned int leaf, unsigned int subleaf, CpuidRegs &regs)
 {
-    std::longjmp(env, 1);
-}
-#endif
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, leaf & 0x80000000);
+    if (static_cast<unsigned int>(info[0]) < leaf) {
+        return false;
+    }
+    __cpuidex(info, leaf, subleaf);
+    regs.eax = info[0];
+    regs.ebx = info[1];
+    regs.ecx = info[2];
+    regs.edx = info[3];
+#else
+    // __get_cpuid_max() also covers 32-bit CPUs without the CPUID instruction
+    if (__get_cpuid_max(leaf & 0x80000000, nullptr) < leaf) {
+        return false;
+    }
+    __cpuid_count(leaf, subleaf, regs.eax, regs.ebx, regs.ecx, regs.edx);
 #endif
+    return true;
+}
 
-#ifdef __i386__
-#define ASM_REG(reg)              "%e" reg
-#define ASM_POP(reg)              "popl   %%e" reg "             \n\t"
-#define ASM_PUSH(reg)             "pushl  %%e" reg "             \n\t"
-#define ASM_XOR_REG(reg1, reg2)   "xorl   %%e" reg1 ", %%e" reg2 " \n\t"
-#define ASM_XOR_VAR(var, reg)     "xorl   " var ",     %%e" reg "  \n\t"
-#define ASM_CMP_REG(reg1, reg2)   "cmpl   %%e" reg1 ", %%e" reg2 " \n\t"
-#define ASM_MOV_REG(reg1, reg2)   "movl   %%e" reg1 ", %%e" reg2 " \n\t"
-#define ASM_MOV_VAR(var, reg)     "movl   " var ",     %%e" reg "  \n\t"
-#elif defined(__x86_64__)
-#define ASM_REG(reg)              "%r" reg
-#define ASM_POP(reg)              "popq   %%r" reg "             \n\t"
-#define ASM_PUSH(reg)             "pushq  %%r" reg "             \n\t"
-#define ASM_XOR_REG(reg1, reg2)   "xorq   %%r" reg1 ", %%r" reg2 " \n\t"
-#define ASM_XOR_VAR(var, reg)     "xorq   " var ",     %%r" reg "  \n\t"
-#define ASM_CMP_REG(reg1, reg2)   "cmpq   %%r" reg1 ", %%r" reg2 " \n\t"
-#define ASM_MOV_REG(reg1, reg2)   "movq   %%r" reg1 ", %%r" reg2 " \n\t"
-#define ASM_MOV_VAR(var, reg)     "movq   " var ",     %%r" reg "  \n\t"
-#endif
+// the register state the OS saves and restores on context switches (XCR0)
+unsigned long long enabledXStates()
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    // the _xgetbv() intrinsic needs -mxsave, which we can't assume
+    unsigned int eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
 #endif
+}
 
-#ifdef __PPC__
+inline bool bit(unsigned int reg, int n)
+{
+    return reg & (1u << n);
+}
+
+// XCR0 components needed by each extension family
+const unsigned long long XStateSse = 0x2;
+const unsigned long long XStateAvx = 0x4;
+const unsigned long long XStateAvx512 = 0xe0;   // opmask, ZMM_Hi256, Hi16_ZMM
+const unsigned long long XStateAmx = 0x60000;   // XTILECFG, XTILEDATA
+}
+
+static Solid::Processor::InstructionSets x86Features()
+{
+    Solid::Processor::InstructionSets featureflags;
+
+    CpuidRegs leaf1;
+    if (!cpuid(1, 0, leaf1)) {
+        return featureflags;
+    }
+
+    // Without OSXSAVE the OS doesn't manage extended state at all: SSE is
+    // then assumed usable (every OS of this century saves it), AVX and
+    // later extensions are not.
+    unsigned long long xstates = XStateSse;
+    if (bit(leaf1.ecx, 27)) {
+        xstates = enabledXStates();
+    }
+    const bool osSse = (xstates & XStateSse) == XStateSse;
+    const bool osAvx = (xstates & (XStateSse | XStateAvx)) == (XStateSse | XStateAvx);
+    const bool osAvx512 = osAvx && (xstates & XStateAvx512) == XStateAvx512;
+    const bool osAmx = (xstates & XStateAmx) == XStateAmx;
+
+    if (bit(leaf1.edx, 23)) {
+        featureflags |= Solid::Processor::IntelMmx;
+    }
+    if (osSse) {
+        if (bit(leaf1.edx, 25)) {
+            featureflags |= Solid::Processor::IntelSse;
+        }
+        if (bit(leaf1.edx, 26)) {
+            featureflags |= Solid::Processor::IntelSse2;
+        }
+        if (bit(leaf1.ecx, 0)) {
+            featureflags |= Solid::Processor::IntelSse3;
+        }
+        if (bit(leaf1.ecx, 9)) {
+            featureflags |= Solid::Processor::IntelSsse3;
+        }
+        if (bit(leaf1.ecx, 19)) {
+            featureflags |= Solid::Processor::IntelSse41;
+        }
+        if (bit(leaf1.ecx, 20)) {
+            featureflags |= Solid::Processor::IntelSse42;
+        }
+    }
+    if (osAvx) {
+        if (bit(leaf1.ecx, 28)) {
+            featureflags |= Solid::Processor::IntelAvx;
+        }
+        if (bit(leaf1.ecx, 12)) {
+            featureflags |= Solid::Processor::IntelFma;
+        }
+        if (bit(leaf1.ecx, 29)) {
+            featureflags |= Solid::Processor::IntelF16c;
+        }
+    }
+
+    CpuidRegs leaf7;
+    if (cpuid(7, 0, leaf7)) {
+        // BMI and SHA operate on general purpose/SSE registers
+        if (bit(leaf7.ebx, 3)) {
+            featureflags |= Solid::Processor::IntelBmi1;
+        }
+        if (bit(leaf7.ebx, 8)) {
+            featureflags |= Solid::Processor::IntelBmi2;
+        }
+        if (osSse && bit(leaf7.ebx, 29)) {
+            featureflags |= Solid::Processor::IntelSha;
+        }
+
+        if (osAvx) {
+            if (bit(leaf7.ebx, 5)) {
+                featureflags |= Solid::Processor::IntelAvx2;
+            }
+            if (bit(leaf7.ecx, 9)) {
+                featureflags |= Solid::Processor::IntelVaes;
+            }
+        }
+
+        if (osAvx512 && bit(leaf7.ebx, 16)) {
+            featureflags |= Solid::Processor::IntelAvx512F;
+            if (bit(leaf7.ebx, 28)) {
+                featureflags |= Solid::Processor::IntelAvx512Cd;
+            }
+            if (bit(leaf7.ebx, 17)) {
+                featureflags |= Solid::Processor::IntelAvx512Dq;
+            }
+            if (bit(leaf7.ebx, 30)) {
+                featureflags |= Solid::Processor::IntelAvx512Bw;
+            }
+            if (bit(leaf7.ebx, 31)) {
+                featureflags |= Solid::Processor::IntelAvx512Vl;
+            }
+            if (bit(leaf7.ebx, 21)) {
+                featureflags |= Solid::Processor::IntelAvx512Ifma;
+            }
+            if (bit(leaf7.ecx, 1)) {
+                featureflags |= Solid::Processor::IntelAvx512Vbmi;
+            }
+            if (bit(leaf7.ecx, 11)) {
+                featureflags |= Solid::Processor::IntelAvx512Vnni;
+            }
+        }
+
+        if (osAmx && bit(leaf7.edx, 24)) {
+            featureflags |= Solid::Processor::IntelAmxTile;
+            if (bit(leaf7.edx, 22)) {
+                featureflags |= Solid::Processor::IntelAmxBf16;
+            }
+            if (bit(leaf7.edx, 25)) {
+                featureflags |= Solid::Processor::IntelAmxInt8;
+            }
+        }
+    }
+
+    CpuidRegs extended;
+    if (cpuid(0x80000001, 0, extended) && bit(extended.edx, 31)) {
+        featureflags |= Solid::Processor::Amd3DNow;
+    }
+
+    return featureflags;
+}
+#endif // SOLID_X86_CPUID
+
+#if defined(__PPC__) && defined(HAVE_PPC_ALTIVEC)
 static sigjmp_buf jmpbuf;
 static sig_atomic_t canjump = 0;
 
@@ -90,92 +234,10 @@ static void sigill_handler(int sig)
     canjump = 0;
     siglongjmp(jmpbuf, 1);
 }
-#endif
 
-Solid::Processor::InstructionSets cpuFeatures()
+static bool haveAltiVec()
 {
-    volatile unsigned int features = 0;
-
-#if defined( HAVE_GNU_INLINE_ASM )
-#if defined( __i386__ ) || defined( __x86_64__ )
-    bool haveCPUID = false;
-    unsigned int result = 0, result2 = 0;
-
-    // First check if the CPU supports the CPUID instruction
-    __asm__ __volatile__(
-        // Try to toggle the CPUID bit in the EFLAGS register
-        "pushf                      \n\t"   // Push the EFLAGS register onto the stack
-        ASM_POP("cx")                       // Pop the value into ECX
-        ASM_MOV_REG("cx", "dx")             // Copy ECX to EDX
-        ASM_XOR_VAR("$0x00200000", "cx")    // Toggle bit 21 (CPUID) in ECX
-        ASM_PUSH("cx")                      // Push the modified value onto the stack
-        "popf                       \n\t"   // Pop it back into EFLAGS
-
-        // Check if the CPUID bit was successfully toggled
-        "pushf                      \n\t"   // Push EFLAGS back onto the stack
-        ASM_POP("cx")                       // Pop the value into ECX
-        ASM_XOR_REG("ax", "ax")             // Zero out the EAX register
-        ASM_CMP_REG("cx", "dx")             // Compare ECX with EDX
-        "je    .Lno_cpuid_support%= \n\t"   // Jump if they're identical
-        ASM_MOV_VAR("$1", "ax")             // Set EAX to true
-        ".Lno_cpuid_support%=:      \n\t"
-        : "=a"(haveCPUID) : : ASM_REG("cx"), ASM_REG("dx"));
-
-    // If we don't have CPUID we won't have the other extensions either
-    if (haveCPUID) {
-        // Execute CPUID with the feature request bit set
-        __asm__ __volatile__(
-            ASM_PUSH("bx")                      // Save EBX
-            ASM_MOV_VAR("$1", "ax")             // Set EAX to 1 (features request)
-            "cpuid                      \n\t"   // Call CPUID
-            ASM_POP("bx")                       // Restore EBX
-            : "=d"(result), "=c"(result2) : : ASM_REG("ax"));
-
-        features = result & 0x06800000; //copy the mmx and sse & sse2 bits to features
-        features |= result2 & 0x00180101; //copy the ssse3, sse3 and sse4.1, sse4.2 bits to features
-
-        __asm__ __volatile__(
-            ASM_PUSH("bx")
-            ASM_PUSH("dx")
-            ASM_MOV_VAR("$0x80000000", "ax")
-            ASM_MOV_VAR("$0x80000000", "dx")
-            "cpuid                   \n\t"
-            ASM_CMP_REG("dx", "ax")
-            "jbe .Lno_extended%=     \n\t"
-            ASM_MOV_VAR("$0x80000001", "ax")
-            "cpuid                   \n\t"
-            ".Lno_extended%=:        \n\t"
-            ASM_POP("dx")
-            ASM_POP("bx")                      // Restore EBX
-            : "=d"(result) : : ASM_REG("ax"), ASM_REG("cx"));
-
-        if (result & 0x80000000) {
-            features |= 0x80000000;
-        }
-
-#ifdef HAVE_X86_SSE
-        // Test bit 25 (SSE support)
-        if (features & 0x02000000) {
-            // OS support test for SSE.
-            // Install our own sighandler for SIGILL.
-            kde_sighandler_t oldhandler = std::signal(SIGILL, sighandler);
-
-            // Try executing an SSE insn to see if we get a SIGILL
-            if (setjmp(env)) {
-                features &= ~0x06080001;    // The OS support test failed
-            } else {
-                __asm__ __volatile__("xorps %xmm0, %xmm0");
-            }
-
-            // Restore the default sighandler
-            std::signal(SIGILL, oldhandler);
-
-            // Note: The OS requirements for SSE2 are the same as for SSE
-            //       so we don't have to do any additional tests for that.
-        }
-#endif // HAVE_X86_SSE
-    }
-#elif defined __PPC__ && defined HAVE_PPC_ALTIVEC
+    bool result = false;
     signal(SIGILL, sigill_handler);
     if (sigsetjmp(jmpbuf, 1)) {
         signal(SIGILL, SIG_DFL);
@@ -186,50 +248,23 @@ Solid::Processor::InstructionSets cpuFeatures()
                              : /* none */
                              : "r"(-1));
         signal(SIGILL, SIG_DFL);
-        features = 0x2;
+        result = true;
     }
-#endif // __i386__ || __x86_64__
-#elif defined(_MSC_VER)
-    int array[4], ft = 1;
-    __cpuid(array, ft);
-
-    features = array[3] & 0x06800000; //copy the mmx and sse & sse2 bits to features
-    features |= array[2] & 0x00180101; //copy the ssse3, sse3 and sse4.1, sse4.2 bits to features
+    return result;
+}
+#endif
 
-    if (array[3] & 0x80000000) {
-        features |= 0x80000000;
-    }
-#endif //HAVE_GNU_INLINE_ASM
+Solid::Processor::InstructionSets cpuFeatures()
+{
     Solid::Processor::InstructionSets featureflags;
 
-    if (features & 0x80000000) {
-        featureflags |= Solid::Processor::Amd3DNow;
-    }
-    if (features & 0x00800000) {
-        featureflags |= Solid::Processor::IntelMmx;
-    }
-    if (features & 0x02000000) {
-        featureflags |= Solid::Processor::IntelSse;
-    }
-    if (features & 0x04000000) {
-        featureflags |= Solid::Processor::IntelSse2;
-    }
-    if (features & 0x00000001) {
-        featureflags |= Solid::Processor::IntelSse3;
-    }
-    if (features & 0x00000100) {
-        featureflags |= Solid::Processor::IntelSsse3;
-    }
-    if (features & 0x00080000) {
-        featureflags |= Solid::Processor::IntelSse41;
-    }
-    if (features & 0x00100000) {
-        featureflags |= Solid::Processor::IntelSse42;
-    }
-
-    if (features & 0x2) {
+#if defined(SOLID_X86_CPUID)
+    featureflags = x86Features();
+#elif defined(__PPC__) && defined(HAVE_PPC_ALTIVEC)
+    if (haveAltiVec()) {
         featureflags |= Solid::Processor::AltiVec;
     }
+#endif
 
     return featureflags;
 }
@@ -0,0 +1,63 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "memoryblocks.h"
+#include "sysfsfile.h"
+
+#include <QtCore/QDir>
+
+using namespace Solid::Backends::Shared;
+
+QStringList MemoryBlocks::list(const QString &nodePath)
+{
+    QStringList blocks;
+    Q_FOREACH (const QString &name, QDir(nodePath).entryList(QStringList() << QStringLiteral("memory*"), QDir::Dirs)) {
+        if (isBlockName(name)) {
+            blocks << name;
+        }
+    }
+    return blocks;
+}
+
+int MemoryBlocks::onlineCount(const QString &nodePath)
+{
+    int online = 0;
+    Q_FOREACH (const QString &block, list(nodePath)) {
+        SysfsFile file(nodePath + QLatin1Char('/') + block + QLatin1String("/online"));
+        if (file.read() == "1") {
+            ++online;
+        }
+    }
+    return online;
+}
+
+bool MemoryBlocks::isBlockName(const QString &name)
+{
+    static const int prefixLength = 6; // "memory"
+    if (name.size() <= prefixLength || !name.startsWith(QLatin1String("memory"))) {
+        return false;
+    }
+    for (int i = prefixLength; i < name.size(); ++i) {
+        if (!name.at(i).isDigit()) {
+            return false;
+        }
+    }
+    return true;
+}
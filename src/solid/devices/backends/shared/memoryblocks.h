@@ -0,0 +1,61 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_SHARED_MEMORYBLOCKS_H
+#define SOLID_BACKENDS_SHARED_MEMORYBLOCKS_H
+
+#include <QtCore/QStringList>
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Shared
+{
+
+/**
+ * The memory blocks linked from a NUMA node directory, such as
+ * /sys/devices/system/node/node0/memory42.
+ *
+ * Blocks are listed live, since memory can be hot-(un)plugged. The node
+ * directory holds other memory_* entries, e.g. memory_side_cache and
+ * memory_failure, which are not blocks.
+ */
+class MemoryBlocks
+{
+public:
+    /**
+     * @return the names of the memoryN directories of the node at @p nodePath
+     */
+    static QStringList list(const QString &nodePath);
+
+    /**
+     * @return the number of those blocks that are online
+     */
+    static int onlineCount(const QString &nodePath);
+
+    static bool isBlockName(const QString &name);
+};
+
+}
+}
+}
+
+#endif // SOLID_BACKENDS_SHARED_MEMORYBLOCKS_H
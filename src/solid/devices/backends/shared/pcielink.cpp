@@ -0,0 +1,113 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "pcielink.h"
+
+#include <QtCore/QFileInfo>
+
+using namespace Solid::Backends::Shared;
+
+// the lower of two values, where 0 stands for unknown
+template<typename T>
+static T minKnown(T a, T b)
+{
+    if (a <= 0) {
+        return b;
+    }
+    if (b <= 0) {
+        return a;
+    }
+    return qMin(a, b);
+}
+
+PcieLink::PcieLink(const QString &devicePath)
+    : m_valid(false)
+    , m_maxSpeed(0)
+    , m_maxWidth(0)
+{
+    QString path = QFileInfo(devicePath).canonicalFilePath();
+    while (path.startsWith(QLatin1String("/sys/devices/"))) {
+        if (QFileInfo::exists(path + QLatin1String("/max_link_speed"))) {
+            m_valid = true;
+            break;
+        }
+        path.truncate(path.lastIndexOf(QLatin1Char('/')));
+    }
+    if (!m_valid) {
+        return;
+    }
+
+    SysfsFile maxSpeed(path + QLatin1String("/max_link_speed"));
+    SysfsFile maxWidth(path + QLatin1String("/max_link_width"));
+    m_maxSpeed = parseSpeed(maxSpeed.read());
+    m_maxWidth = maxWidth.readLongLong();
+    m_speed.setPath(path + QLatin1String("/current_link_speed"));
+    m_width.setPath(path + QLatin1String("/current_link_width"));
+
+    // the attributes above are the capabilities of the device's end of the
+    // link only; the other end is the downstream port of the bridge above,
+    // the next directory up that has them. A Gen4 device in a Gen3 slot can
+    // never train faster than Gen3.
+    QString upstream = path.left(path.lastIndexOf(QLatin1Char('/')));
+    while (upstream.startsWith(QLatin1String("/sys/devices/"))) {
+        if (QFileInfo::exists(upstream + QLatin1String("/max_link_speed"))) {
+            SysfsFile portSpeed(upstream + QLatin1String("/max_link_speed"));
+            SysfsFile portWidth(upstream + QLatin1String("/max_link_width"));
+            m_maxSpeed = minKnown(m_maxSpeed, parseSpeed(portSpeed.read()));
+            m_maxWidth = minKnown(m_maxWidth, int(portWidth.readLongLong()));
+            break;
+        }
+        upstream.truncate(upstream.lastIndexOf(QLatin1Char('/')));
+    }
+}
+
+bool PcieLink::isValid() const
+{
+    return m_valid;
+}
+
+double PcieLink::speed()
+{
+    return m_valid ? parseSpeed(m_speed.read()) : 0;
+}
+
+int PcieLink::width()
+{
+    return m_valid ? int(m_width.readLongLong()) : 0;
+}
+
+double PcieLink::maxSpeed() const
+{
+    return m_maxSpeed;
+}
+
+int PcieLink::maxWidth() const
+{
+    return m_maxWidth;
+}
+
+double PcieLink::parseSpeed(const QByteArray &speed)
+{
+    // "2.5 GT/s", or "8.0 GT/s PCIe" since Linux 4.20
+    const int space = speed.indexOf(' ');
+    bool ok;
+    const double rate = speed.left(space).toDouble(&ok);
+    return ok ? rate : 0;
+}
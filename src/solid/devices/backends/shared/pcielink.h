@@ -0,0 +1,95 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_SHARED_PCIELINK_H
+#define SOLID_BACKENDS_SHARED_PCIELINK_H
+
+#include "sysfsfile.h"
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Shared
+{
+
+/**
+ * The PCI Express link of the PCI function a device sits on, found by
+ * walking up the sysfs hierarchy from the device. For an NVMe namespace
+ * that's the NVMe controller, for a SATA disk the AHCI controller.
+ *
+ * The maximum speed and width are read once, as the lower of what the
+ * device and the upstream bridge port support; the negotiated ones are
+ * read live since a link can retrain, and their files stay open.
+ */
+class PcieLink
+{
+public:
+    /**
+     * @param devicePath the sysfs path of the device, symlinks are resolved
+     */
+    explicit PcieLink(const QString &devicePath);
+
+    /**
+     * @return false if the device isn't behind a PCI Express link
+     */
+    bool isValid() const;
+
+    /**
+     * @return the negotiated transfer rate in GT/s, 0 if unknown
+     */
+    double speed();
+    /**
+     * @return the negotiated number of lanes, 0 if unknown
+     */
+    int width();
+    /**
+     * @return the highest transfer rate both ends of the link support in
+     * GT/s, 0 if unknown
+     */
+    double maxSpeed() const;
+    /**
+     * @return the highest number of lanes both ends of the link support,
+     * 0 if unknown
+     */
+    int maxWidth() const;
+
+    /**
+     * Parses a link speed attribute such as "8.0 GT/s PCIe".
+     *
+     * @return the transfer rate in GT/s, 0 for "Unknown"
+     */
+    static double parseSpeed(const QByteArray &speed);
+
+private:
+    Q_DISABLE_COPY(PcieLink)
+
+    bool m_valid;
+    SysfsFile m_speed;
+    SysfsFile m_width;
+    double m_maxSpeed;
+    int m_maxWidth;
+};
+
+}
+}
+}
+
+#endif // SOLID_BACKENDS_SHARED_PCIELINK_H
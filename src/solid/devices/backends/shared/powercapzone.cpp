@@ -0,0 +1,98 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "powercapzone.h"
+
+using namespace Solid::Backends::Shared;
+
+PowercapZone::PowercapZone(const QString &path)
+    : m_range(0)
+    , m_energy(path + QLatin1String("/energy_uj"))
+    , m_started(false)
+    , m_last(0)
+    , m_total(0)
+{
+    SysfsFile name(path + QLatin1String("/name"));
+    SysfsFile range(path + QLatin1String("/max_energy_range_uj"));
+    m_name = QString::fromLatin1(name.read());
+    m_range = range.readULongLong();
+}
+
+QString PowercapZone::name() const
+{
+    return m_name;
+}
+
+Solid::EnergyCounter::Domain PowercapZone::domain() const
+{
+    return domainFromName(m_name);
+}
+
+qulonglong PowercapZone::maxEnergyRange() const
+{
+    return m_range;
+}
+
+qulonglong PowercapZone::energy(bool *ok)
+{
+    bool read;
+    const qulonglong current = m_energy.readULongLong(&read);
+    if (ok) {
+        *ok = read;
+    }
+    if (!read) {
+        return m_total;
+    }
+
+    if (m_started) {
+        m_total += energyDelta(current, m_last, m_range);
+    }
+    m_started = true;
+    m_last = current;
+    return m_total;
+}
+
+qulonglong PowercapZone::energyDelta(qulonglong current, qulonglong previous, qulonglong range)
+{
+    if (current >= previous) {
+        return current - previous;
+    }
+    // the counter went from previous up to range, then from 0 to current
+    if (previous > range) {
+        return current;
+    }
+    return range - previous + current;
+}
+
+Solid::EnergyCounter::Domain PowercapZone::domainFromName(const QString &name)
+{
+    if (name.startsWith(QLatin1String("package"))) {
+        return Solid::EnergyCounter::Package;
+    } else if (name == QLatin1String("core")) {
+        return Solid::EnergyCounter::Core;
+    } else if (name == QLatin1String("uncore")) {
+        return Solid::EnergyCounter::Uncore;
+    } else if (name == QLatin1String("dram")) {
+        return Solid::EnergyCounter::Dram;
+    } else if (name == QLatin1String("psys")) {
+        return Solid::EnergyCounter::Platform;
+    }
+    return Solid::EnergyCounter::UnknownDomain;
+}
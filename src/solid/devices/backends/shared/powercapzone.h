@@ -0,0 +1,89 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_SHARED_POWERCAPZONE_H
+#define SOLID_BACKENDS_SHARED_POWERCAPZONE_H
+
+#include <solid/energycounter.h>
+
+#include "sysfsfile.h"
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Shared
+{
+
+/**
+ * The energy counter of a powercap zone, such as /sys/class/powercap/intel-rapl:0.
+ *
+ * The kernel counter wraps around at max_energy_range_uj, which at a few
+ * hundred watts happens within the hour. energy() folds every wrap it sees
+ * into a 64 bit total, which stays correct as long as the zone is read at
+ * least once per wrap period.
+ */
+class PowercapZone
+{
+public:
+    explicit PowercapZone(const QString &path);
+
+    /**
+     * @return the zone name, e.g. "package-0" or "dram"
+     */
+    QString name() const;
+    Solid::EnergyCounter::Domain domain() const;
+
+    /**
+     * @return the value at which the kernel counter wraps, in microjoules
+     */
+    qulonglong maxEnergyRange() const;
+
+    /**
+     * @return the energy consumed since the first read, in microjoules
+     * @param ok set to false if the counter can't be read, which is the case
+     * for unprivileged users since Linux 5.10
+     */
+    qulonglong energy(bool *ok = nullptr);
+
+    /**
+     * @return the energy consumed between two raw counter values, assuming
+     * the counter wrapped at most once in between
+     */
+    static qulonglong energyDelta(qulonglong current, qulonglong previous, qulonglong range);
+
+    static Solid::EnergyCounter::Domain domainFromName(const QString &name);
+
+private:
+    Q_DISABLE_COPY(PowercapZone)
+
+    QString m_name;
+    qulonglong m_range;
+    SysfsFile m_energy;
+    bool m_started;
+    qulonglong m_last;
+    qulonglong m_total;
+};
+
+}
+}
+}
+
+#endif // SOLID_BACKENDS_SHARED_POWERCAPZONE_H
@@ -0,0 +1,135 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "pressurestall.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QList>
+#include <qplatformdefs.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace Solid::Backends::Shared;
+
+PressureStall::PressureStall(const QString &path)
+    : m_file(path)
+{
+}
+
+QString PressureStall::path() const
+{
+    return m_file.path();
+}
+
+bool PressureStall::read(Solid::Pressure::Stall *some, Solid::Pressure::Stall *full)
+{
+    const QByteArray contents = m_file.read();
+    if (contents.isNull()) {
+        return false;
+    }
+    return parse(contents, some, full);
+}
+
+int PressureStall::openTrigger(Solid::Pressure::StallType type, qulonglong threshold, qulonglong window) const
+{
+    const QByteArray path = QFile::encodeName(m_file.path());
+    const int fd = QT_OPEN(path.constData(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    // the kernel expects the terminating null to be written as well; it
+    // rejects windows outside 500ms to 10s, and unprivileged users may only
+    // use windows that are a multiple of 2s
+    const QByteArray spec = triggerSpec(type, threshold, window);
+    ssize_t written;
+    do {
+        written = QT_WRITE(fd, spec.constData(), spec.size() + 1);
+    } while (written < 0 && errno == EINTR);
+
+    if (written < 0) {
+        QT_CLOSE(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool PressureStall::parse(const QByteArray &contents, Solid::Pressure::Stall *some, Solid::Pressure::Stall *full)
+{
+    *some = Solid::Pressure::Stall();
+    *full = Solid::Pressure::Stall();
+
+    bool foundSome = false;
+    const QList<QByteArray> lines = contents.split('\n');
+    Q_FOREACH (const QByteArray &line, lines) {
+        const QList<QByteArray> fields = line.simplified().split(' ');
+        Solid::Pressure::Stall *stall;
+        if (fields.first() == "some") {
+            stall = some;
+            foundSome = true;
+        } else if (fields.first() == "full") {
+            stall = full;
+        } else {
+            continue;
+        }
+
+        for (int i = 1; i < fields.size(); ++i) {
+            const int separator = fields.at(i).indexOf('=');
+            if (separator < 0) {
+                return false;
+            }
+            const QByteArray key = fields.at(i).left(separator);
+            const QByteArray value = fields.at(i).mid(separator + 1);
+            if (key == "avg10") {
+                stall->avg10 = value.toDouble();
+            } else if (key == "avg60") {
+                stall->avg60 = value.toDouble();
+            } else if (key == "avg300") {
+                stall->avg300 = value.toDouble();
+            } else if (key == "total") {
+                stall->total = value.toULongLong();
+            }
+        }
+    }
+    return foundSome;
+}
+
+QByteArray PressureStall::triggerSpec(Solid::Pressure::StallType type, qulonglong threshold, qulonglong window)
+{
+    QByteArray spec(type == Solid::Pressure::Full ? "full " : "some ");
+    spec += QByteArray::number(threshold);
+    spec += ' ';
+    spec += QByteArray::number(window);
+    return spec;
+}
+
+Solid::Pressure::Resource PressureStall::resourceFromName(const QString &name)
+{
+    if (name == QLatin1String("cpu")) {
+        return Solid::Pressure::Cpu;
+    } else if (name == QLatin1String("memory")) {
+        return Solid::Pressure::Memory;
+    } else if (name == QLatin1String("io")) {
+        return Solid::Pressure::Io;
+    }
+    return Solid::Pressure::UnknownResource;
+}
@@ -0,0 +1,79 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_SHARED_PRESSURESTALL_H
+#define SOLID_BACKENDS_SHARED_PRESSURESTALL_H
+
+#include <solid/pressure.h>
+
+#include "sysfsfile.h"
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Shared
+{
+
+/**
+ * The pressure stall information of a resource, such as /proc/pressure/io.
+ *
+ * Each file holds a "some" line and, for memory and io as well as for cpu
+ * since Linux 5.13, a "full" line:
+ * some avg10=0.12 avg60=0.05 avg300=0.01 total=123456
+ */
+class PressureStall
+{
+public:
+    explicit PressureStall(const QString &path);
+
+    QString path() const;
+
+    /**
+     * Reads the current figures. A missing "full" line leaves full zeroed.
+     *
+     * @return false if the file can't be read or parsed
+     */
+    bool read(Solid::Pressure::Stall *some, Solid::Pressure::Stall *full);
+
+    /**
+     * Opens a trigger on the pressure file, which the kernel signals with
+     * POLLPRI once the stall time within a window exceeds the threshold.
+     * Both are in microseconds.
+     *
+     * @return the trigger descriptor, or -1 if the kernel refused the trigger
+     */
+    int openTrigger(Solid::Pressure::StallType type, qulonglong threshold, qulonglong window) const;
+
+    static bool parse(const QByteArray &contents, Solid::Pressure::Stall *some, Solid::Pressure::Stall *full);
+    static QByteArray triggerSpec(Solid::Pressure::StallType type, qulonglong threshold, qulonglong window);
+    static Solid::Pressure::Resource resourceFromName(const QString &name);
+
+private:
+    Q_DISABLE_COPY(PressureStall)
+
+    SysfsFile m_file;
+};
+
+}
+}
+}
+
+#endif // SOLID_BACKENDS_SHARED_PRESSURESTALL_H
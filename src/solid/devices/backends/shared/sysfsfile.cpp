@@ -0,0 +1,160 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "sysfsfile.h"
+
+#include <QtCore/QAtomicInt>
+#include <QtCore/QFile>
+#include <qplatformdefs.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace Solid::Backends::Shared;
+
+// stay well below the usual soft limit of 1024 descriptors, hosts with a few
+// hundred CPUs would otherwise exhaust it with per-CPU attributes alone
+static const int s_maxOpenFiles = 512;
+static QAtomicInt s_openFiles;
+
+SysfsFile::SysfsFile(const QString &path)
+    : m_fd(-1)
+    , m_keepOpen(false)
+    , m_missing(false)
+{
+    setPath(path);
+}
+
+SysfsFile::~SysfsFile()
+{
+    close();
+}
+
+QString SysfsFile::path() const
+{
+    return m_path;
+}
+
+void SysfsFile::setPath(const QString &path)
+{
+    close();
+    m_path = path;
+    m_encodedPath = QFile::encodeName(path);
+    m_missing = path.isEmpty();
+}
+
+bool SysfsFile::exists() const
+{
+    return !m_missing;
+}
+
+bool SysfsFile::open()
+{
+    if (m_fd >= 0) {
+        return true;
+    }
+    if (m_missing) {
+        return false;
+    }
+
+    m_fd = QT_OPEN(m_encodedPath.constData(), O_RDONLY | O_CLOEXEC);
+    if (m_fd < 0) {
+        if (errno == ENOENT || errno == ENOTDIR) {
+            m_missing = true;
+        }
+        return false;
+    }
+
+    m_keepOpen = s_openFiles.fetchAndAddRelaxed(1) < s_maxOpenFiles;
+    if (!m_keepOpen) {
+        s_openFiles.deref();
+    }
+    return true;
+}
+
+void SysfsFile::close()
+{
+    if (m_fd < 0) {
+        return;
+    }
+
+    QT_CLOSE(m_fd);
+    m_fd = -1;
+    if (m_keepOpen) {
+        s_openFiles.deref();
+        m_keepOpen = false;
+    }
+}
+
+QByteArray SysfsFile::read()
+{
+    if (!open()) {
+        return QByteArray();
+    }
+
+    // attributes are at most a page; procfs files we read are small as well
+    char buffer[4096];
+    ssize_t count;
+    do {
+        count = ::pread(m_fd, buffer, sizeof(buffer), 0);
+    } while (count < 0 && errno == EINTR);
+
+    if (count < 0) {
+        // e.g. the device went away; try again from scratch next time
+        close();
+        return QByteArray();
+    }
+
+    const QByteArray result = QByteArray(buffer, int(count)).trimmed();
+    if (!m_keepOpen) {
+        close();
+    }
+    return result;
+}
+
+qlonglong SysfsFile::readLongLong(bool *ok)
+{
+    const QByteArray value = read();
+    if (value.isNull()) {
+        if (ok) {
+            *ok = false;
+        }
+        return 0;
+    }
+    return value.toLongLong(ok);
+}
+
+qulonglong SysfsFile::readULongLong(bool *ok)
+{
+    const QByteArray value = read();
+    if (value.isNull()) {
+        if (ok) {
+            *ok = false;
+        }
+        return 0;
+    }
+    return value.toULongLong(ok);
+}
+
+int SysfsFile::openFiles()
+{
+    return s_openFiles.load();
+}
@@ -0,0 +1,85 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_SHARED_SYSFSFILE_H
+#define SOLID_BACKENDS_SHARED_SYSFSFILE_H
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+namespace Solid
+{
+namespace Backends
+{
+namespace Shared
+{
+
+/**
+ * A sysfs or procfs attribute that is read repeatedly.
+ *
+ * The file is opened on first use and kept open; every read() is a single
+ * pread() at offset 0, which makes the kernel regenerate the attribute.
+ * Only a limited number of descriptors is kept open process-wide, files
+ * beyond that budget are reopened for every read instead.
+ */
+class SysfsFile
+{
+public:
+    explicit SysfsFile(const QString &path = QString());
+    ~SysfsFile();
+
+    QString path() const;
+    void setPath(const QString &path);
+
+    /**
+     * @return false once opening the file failed because it doesn't exist
+     */
+    bool exists() const;
+
+    /**
+     * @return the current contents with surrounding whitespace removed, or a
+     * null QByteArray if the file can't be read
+     */
+    QByteArray read();
+    qlonglong readLongLong(bool *ok = nullptr);
+    qulonglong readULongLong(bool *ok = nullptr);
+
+    void close();
+
+    // the number of descriptors currently held open by all SysfsFiles
+    static int openFiles();
+
+private:
+    Q_DISABLE_COPY(SysfsFile)
+
+    bool open();
+
+    QString m_path;
+    QByteArray m_encodedPath;
+    int m_fd;
+    bool m_keepOpen;
+    bool m_missing;
+};
+
+}
+}
+}
+
+#endif // SOLID_BACKENDS_SHARED_SYSFSFILE_H
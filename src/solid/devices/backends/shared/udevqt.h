@@ -3,5 +3,6 @@
 
 #include "udevqtclient.h"
 #include "udevqtdevice.h"
+#include "udevqtdevicecache.h"
 
 #endif
@@ -27,6 +27,10 @@ extern "C"
 #include <libudev.h>
 }
 
+#include <QtCore/QAtomicPointer>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QThread>
+
 class QByteArray;
 class QSocketNotifier;
 
@@ -43,6 +47,61 @@ public:
     QString decodePropertyValue(const QByteArray &encoded) const;
 
     struct udev_device *udev;
+    PropertyMap snapshot;
+    bool snapshotBuilt;
+};
+
+enum DeviceAction { ActionUnknown, ActionAdd, ActionRemove, ActionChange, ActionOnline, ActionOffline };
+
+struct MonitorEvent {
+    struct udev_device *udev;
+    DeviceAction action;
+    MonitorEvent *next;
+};
+
+/*
+ * Lock-free hand-over of monitor events: a producer links a whole batch in
+ * with a single CAS, the consumer detaches everything queued so far with a
+ * single exchange. Only the transition from empty to non-empty needs to wake
+ * the consumer, so a burst costs one queued invocation on the main thread.
+ */
+class MonitorQueue
+{
+public:
+    MonitorQueue();
+    ~MonitorQueue();
+
+    // @p newest ... @p oldest must already be linked through MonitorEvent::next;
+    // returns true if the queue was empty before
+    bool pushChain(MonitorEvent *newest, MonitorEvent *oldest);
+    // detaches all queued events, oldest first
+    MonitorEvent *takeAll();
+
+    static void freeChain(MonitorEvent *event);
+
+private:
+    QAtomicPointer<MonitorEvent> m_head;
+};
+
+class ClientPrivate;
+class MonitorThread : public QThread
+{
+public:
+    MonitorThread(ClientPrivate *client, struct udev_monitor *monitor);
+    ~MonitorThread();
+
+    bool isOperational() const;
+    void stop();
+
+protected:
+    void run() Q_DECL_OVERRIDE;
+
+private:
+    void drain();
+
+    ClientPrivate *m_client;
+    struct udev_monitor *m_monitor;
+    int m_wakeFds[2];
 };
 
 class Client;
@@ -54,16 +113,41 @@ public:
     ClientPrivate(Client *q_);
     ~ClientPrivate();
 
+    static ClientPrivate *get(Client *client);
+
     void init(const QStringList &subsystemList, ListenToWhat what);
     void setWatchedSubsystems(const QStringList &subsystemList);
+    void startMonitor();
+    void stopMonitor();
     void _uq_monitorReadyRead(int fd);
+    void _uq_drainMonitorQueue();
+    // may be called from any thread; takes ownership of the events
+    void enqueueEvents(MonitorEvent *newest, MonitorEvent *oldest);
+    void dispatch(struct udev_device *dev, DeviceAction action);
     DeviceList deviceListFromEnumerate(struct udev_enumerate *en);
 
+    static DeviceAction actionFromString(const char *action);
+
+    // libudev objects are not thread-safe: lookups and enumerations use the
+    // first context on the client's thread, the monitor owns the second one,
+    // so it can be drained on a MonitorThread without sharing a context
     struct udev *udev;
+    struct udev *monitorUdev;
     struct udev_monitor *monitor;
     Client *q;
     QSocketNotifier *monitorNotifier;
+    MonitorThread *monitorThread;
+    MonitorQueue monitorQueue;
     QStringList watchedSubsystems;
+    int monitorMode;
+
+    // only touched on the thread the client lives in
+    quint64 statEvents;
+    quint64 statBatches;
+    qint64 statMainThreadNsecs;
+    qint64 statFirstEventNsecs;
+    qint64 statLastEventNsecs;
+    QElapsedTimer statClock;
 };
 
 inline QStringList listFromListEntry(struct udev_list_entry *list)
@@ -19,32 +19,195 @@
 */
 
 #include "udevqtclient.h"
+#include "udevqtdevicecache.h"
 #include "udevqt_p.h"
 
 #include <QtCore/QSocketNotifier>
+#include <QtCore/QElapsedTimer>
 #include <qplatformdefs.h>
 
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
 namespace UdevQt
 {
 
+// upper bound on the events taken from the socket per wakeup, so a storm
+// still reaches the main thread in reasonably sized, regular batches
+static const int s_maxMonitorBatch = 256;
+
+MonitorQueue::MonitorQueue()
+    : m_head(nullptr)
+{
+}
+
+MonitorQueue::~MonitorQueue()
+{
+    freeChain(takeAll());
+}
+
+bool MonitorQueue::pushChain(MonitorEvent *newest, MonitorEvent *oldest)
+{
+    MonitorEvent *head;
+    do {
+        head = m_head.loadAcquire();
+        oldest->next = head;
+    } while (!m_head.testAndSetOrdered(head, newest));
+
+    return head == nullptr;
+}
+
+MonitorEvent *MonitorQueue::takeAll()
+{
+    MonitorEvent *event = m_head.fetchAndStoreAcquire(nullptr);
+
+    // the stack holds the newest event first
+    MonitorEvent *ordered = nullptr;
+    while (event) {
+        MonitorEvent *next = event->next;
+        event->next = ordered;
+        ordered = event;
+        event = next;
+    }
+    return ordered;
+}
+
+void MonitorQueue::freeChain(MonitorEvent *event)
+{
+    while (event) {
+        MonitorEvent *next = event->next;
+        udev_device_unref(event->udev);
+        delete event;
+        event = next;
+    }
+}
+
+MonitorThread::MonitorThread(ClientPrivate *client, struct udev_monitor *monitor)
+    : m_client(client), m_monitor(udev_monitor_ref(monitor))
+{
+    if (::pipe(m_wakeFds) != 0) {
+        qWarning("UdevQt: unable to create the monitor thread wakeup pipe");
+        m_wakeFds[0] = m_wakeFds[1] = -1;
+    } else {
+        ::fcntl(m_wakeFds[0], F_SETFD, FD_CLOEXEC);
+        ::fcntl(m_wakeFds[1], F_SETFD, FD_CLOEXEC);
+    }
+}
+
+MonitorThread::~MonitorThread()
+{
+    stop();
+    if (m_wakeFds[0] >= 0) {
+        QT_CLOSE(m_wakeFds[0]);
+        QT_CLOSE(m_wakeFds[1]);
+    }
+    udev_monitor_unref(m_monitor);
+}
+
+bool MonitorThread::isOperational() const
+{
+    return m_wakeFds[0] >= 0;
+}
+
+void MonitorThread::stop()
+{
+    if (!isRunning()) {
+        return;
+    }
+
+    const char c = 0;
+    while (QT_WRITE(m_wakeFds[1], &c, 1) < 0 && errno == EINTR) {
+    }
+    wait();
+}
+
+void MonitorThread::run()
+{
+    struct pollfd fds[2];
+    fds[0].fd = udev_monitor_get_fd(m_monitor);
+    fds[0].events = POLLIN;
+    fds[1].fd = m_wakeFds[0];
+    fds[1].events = POLLIN;
+
+    forever {
+        fds[0].revents = fds[1].revents = 0;
+        if (::poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            qWarning("UdevQt: polling the udev monitor failed: %s", strerror(errno));
+            return;
+        }
+
+        if (fds[1].revents) {
+            return;
+        }
+        if (fds[0].revents & POLLIN) {
+            drain();
+        }
+    }
+}
+
+void MonitorThread::drain()
+{
+    // the netlink socket libudev hands out is non-blocking, so this returns
+    // as soon as everything pending has been read
+    MonitorEvent *newest = nullptr;
+    MonitorEvent *oldest = nullptr;
+
+    for (int i = 0; i < s_maxMonitorBatch; ++i) {
+        struct udev_device *dev = udev_monitor_receive_device(m_monitor);
+        if (!dev) {
+            break;
+        }
+
+        MonitorEvent *event = new MonitorEvent;
+        event->udev = dev;
+        event->action = ClientPrivate::actionFromString(udev_device_get_action(dev));
+        event->next = newest;
+        newest = event;
+        if (!oldest) {
+            oldest = event;
+        }
+    }
+
+    if (newest) {
+        m_client->enqueueEvents(newest, oldest);
+    }
+}
+
 ClientPrivate::ClientPrivate(Client *q_)
-    : udev(nullptr), monitor(nullptr), q(q_), monitorNotifier(nullptr)
+    : udev(nullptr), monitorUdev(nullptr), monitor(nullptr), q(q_), monitorNotifier(nullptr), monitorThread(nullptr)
+    , monitorMode(Client::NotifierMonitor)
+    , statEvents(0), statBatches(0), statMainThreadNsecs(0), statFirstEventNsecs(-1), statLastEventNsecs(-1)
 {
+    statClock.start();
 }
 
+
 ClientPrivate::~ClientPrivate()
 {
-    udev_unref(udev);
-    delete monitorNotifier;
+    stopMonitor();
 
     if (monitor) {
         udev_monitor_unref(monitor);
     }
+    udev_unref(monitorUdev);
+    udev_unref(udev);
+}
+
+ClientPrivate *ClientPrivate::get(Client *client)
+{
+    return client->d;
 }
 
 void ClientPrivate::init(const QStringList &subsystemList, ListenToWhat what)
 {
     udev = udev_new();
+    monitorUdev = udev_new();
 
     if (what != ListenToNone) {
         setWatchedSubsystems(subsystemList);
@@ -54,7 +217,7 @@ void ClientPrivate::init(const QStringList &subsystemList, ListenToWhat what)
 void ClientPrivate::setWatchedSubsystems(const QStringList &subsystemList)
 {
     // create a listener
-    struct udev_monitor *newM = udev_monitor_new_from_netlink(udev, "udev");
+    struct udev_monitor *newM = udev_monitor_new_from_netlink(monitorUdev, "udev");
 
     if (!newM) {
         qWarning("UdevQt: unable to create udev monitor connection");
@@ -76,24 +239,57 @@ void ClientPrivate::setWatchedSubsystems(const QStringList &subsystemList)
 
     // start the new monitor receiving
     udev_monitor_enable_receiving(newM);
-    QSocketNotifier *sn = new QSocketNotifier(udev_monitor_get_fd(newM), QSocketNotifier::Read);
-    QObject::connect(sn, SIGNAL(activated(int)), q, SLOT(_uq_monitorReadyRead(int)));
 
     // kill any previous monitor
-    delete monitorNotifier;
+    stopMonitor();
     if (monitor) {
         udev_monitor_unref(monitor);
     }
 
     // and save our new one
     monitor = newM;
-    monitorNotifier = sn;
     watchedSubsystems = subsystemList;
+    startMonitor();
+}
+
+void ClientPrivate::startMonitor()
+{
+    if (!monitor) {
+        return;
+    }
+
+    if (monitorMode == Client::ThreadedMonitor) {
+        monitorThread = new MonitorThread(this, monitor);
+        if (monitorThread->isOperational()) {
+            monitorThread->start();
+            return;
+        }
+        delete monitorThread;
+        monitorThread = nullptr;
+    }
+
+    monitorNotifier = new QSocketNotifier(udev_monitor_get_fd(monitor), QSocketNotifier::Read);
+    QObject::connect(monitorNotifier, SIGNAL(activated(int)), q, SLOT(_uq_monitorReadyRead(int)));
+}
+
+void ClientPrivate::stopMonitor()
+{
+    delete monitorNotifier;
+    monitorNotifier = nullptr;
+
+    if (monitorThread) {
+        monitorThread->stop();
+        delete monitorThread;
+        monitorThread = nullptr;
+    }
 }
 
 void ClientPrivate::_uq_monitorReadyRead(int fd)
 {
     Q_UNUSED(fd);
+    QElapsedTimer timer;
+    timer.start();
+
     monitorNotifier->setEnabled(false);
     struct udev_device *dev = udev_monitor_receive_device(monitor);
     monitorNotifier->setEnabled(true);
@@ -102,21 +298,96 @@ void ClientPrivate::_uq_monitorReadyRead(int fd)
         return;
     }
 
+    ++statBatches;
+    dispatch(dev, actionFromString(udev_device_get_action(dev)));
+    statMainThreadNsecs += timer.nsecsElapsed();
+}
+
+void ClientPrivate::enqueueEvents(MonitorEvent *newest, MonitorEvent *oldest)
+{
+    if (monitorQueue.pushChain(newest, oldest)) {
+        // a drain is already pending whenever the queue was not empty
+        QMetaObject::invokeMethod(q, "_uq_drainMonitorQueue", Qt::QueuedConnection);
+    }
+}
+
+void ClientPrivate::_uq_drainMonitorQueue()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    MonitorEvent *event = monitorQueue.takeAll();
+    if (!event) {
+        return;
+    }
+
+    ++statBatches;
+    while (event) {
+        MonitorEvent *next = event->next;
+        // ownership of the udev_device moves to the emitted Device
+        dispatch(event->udev, event->action);
+        delete event;
+        event = next;
+    }
+    statMainThreadNsecs += timer.nsecsElapsed();
+}
+
+DeviceAction ClientPrivate::actionFromString(const char *action)
+{
+    if (!action) {
+        return ActionUnknown;
+    }
+    if (qstrcmp(action, "add") == 0) {
+        return ActionAdd;
+    } else if (qstrcmp(action, "remove") == 0) {
+        return ActionRemove;
+    } else if (qstrcmp(action, "change") == 0) {
+        return ActionChange;
+    } else if (qstrcmp(action, "online") == 0) {
+        return ActionOnline;
+    } else if (qstrcmp(action, "offline") == 0) {
+        return ActionOffline;
+    }
+    return ActionUnknown;
+}
+
+void ClientPrivate::dispatch(struct udev_device *dev, DeviceAction action)
+{
+    const qint64 now = statClock.nsecsElapsed();
+    if (statFirstEventNsecs < 0) {
+        statFirstEventNsecs = now;
+    }
+    statLastEventNsecs = now;
+    ++statEvents;
+
     Device device(new DevicePrivate(dev, false));
 
-    QByteArray action(udev_device_get_action(dev));
-    if (action == "add") {
+    // keep the shared lookup cache in step with what the monitor sees
+    if (action == ActionRemove) {
+        DeviceCache::remove(device);
+    } else {
+        DeviceCache::update(device);
+    }
+
+    switch (action) {
+    case ActionAdd:
         emit q->deviceAdded(device);
-    } else if (action == "remove") {
+        break;
+    case ActionRemove:
         emit q->deviceRemoved(device);
-    } else if (action == "change") {
+        break;
+    case ActionChange:
         emit q->deviceChanged(device);
-    } else if (action == "online") {
+        break;
+    case ActionOnline:
         emit q->deviceOnlined(device);
-    } else  if (action == "offline") {
+        break;
+    case ActionOffline:
         emit q->deviceOfflined(device);
-    } else {
-        qWarning("UdevQt: unhandled device action \"%s\"", action.constData());
+        break;
+    case ActionUnknown:
+        qWarning("UdevQt: unhandled device action \"%s\"", udev_device_get_action(dev));
+        break;
     }
 }
 
@@ -188,6 +459,43 @@ void Client::setWatchedSubsystems(const QStringList &subsystemList)
     d->setWatchedSubsystems(subsystemList);
 }
 
+Client::MonitorMode Client::monitorMode() const
+{
+    return MonitorMode(d->monitorMode);
+}
+
+void Client::setMonitorMode(MonitorMode mode)
+{
+    if (d->monitorMode == mode) {
+        return;
+    }
+
+    d->stopMonitor();
+    d->monitorMode = mode;
+    d->startMonitor();
+}
+
+Client::MonitorStatistics Client::monitorStatistics() const
+{
+    MonitorStatistics stats;
+    stats.events = d->statEvents;
+    stats.batches = d->statBatches;
+    stats.mainThreadNsecs = d->statMainThreadNsecs;
+    if (d->statFirstEventNsecs >= 0) {
+        stats.activeNsecs = d->statLastEventNsecs - d->statFirstEventNsecs;
+    }
+    return stats;
+}
+
+void Client::resetMonitorStatistics()
+{
+    d->statEvents = 0;
+    d->statBatches = 0;
+    d->statMainThreadNsecs = 0;
+    d->statFirstEventNsecs = -1;
+    d->statLastEventNsecs = -1;
+}
+
 DeviceList Client::devicesByProperty(const QString &property, const QVariant &value)
 {
     struct udev_enumerate *en = udev_enumerate_new(d->udev);
@@ -215,6 +523,21 @@ DeviceList Client::devicesBySubsystem(const QString &subsystem)
     return d->deviceListFromEnumerate(en);
 }
 
+DeviceList Client::devicesBySubsystems(const QStringList &subsystemList)
+{
+    struct udev_enumerate *en = udev_enumerate_new(d->udev);
+
+    // subsystem matches are OR'ed by libudev; "subsystem/devtype" entries as
+    // accepted by the monitor filter are narrowed to their subsystem here
+    Q_FOREACH (const QString &subsysDevtype, subsystemList) {
+        const int ix = subsysDevtype.indexOf(QLatin1Char('/'));
+        const QString subsystem = ix > 0 ? subsysDevtype.left(ix) : subsysDevtype;
+        udev_enumerate_add_match_subsystem(en, subsystem.toLatin1().constData());
+    }
+
+    return d->deviceListFromEnumerate(en);
+}
+
 Device Client::deviceByDeviceFile(const QString &deviceFile)
 {
     QT_STATBUF sb;
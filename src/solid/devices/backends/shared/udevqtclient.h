@@ -40,6 +40,32 @@ class Client : public QObject
     Q_PROPERTY(QStringList watchedSubsystems READ watchedSubsystems WRITE setWatchedSubsystems)
 
 public:
+    enum MonitorMode {
+        // one device per socket notifier wakeup, received on the client's thread
+        NotifierMonitor,
+        // the netlink socket is drained on a dedicated thread and events reach
+        // the client's thread in batches
+        ThreadedMonitor
+    };
+
+    struct MonitorStatistics {
+        MonitorStatistics()
+            : events(0), batches(0), mainThreadNsecs(0), activeNsecs(0) {}
+
+        double eventsPerSecond() const
+        {
+            return activeNsecs > 0 ? events * 1e9 / activeNsecs : 0.0;
+        }
+
+        // events dispatched and the number of event loop iterations they took
+        quint64 events;
+        quint64 batches;
+        // time spent on the client's thread receiving and emitting events
+        qint64 mainThreadNsecs;
+        // time between the first and the last event dispatched
+        qint64 activeNsecs;
+    };
+
     Client(QObject *parent = nullptr);
     Client(const QStringList &subsystemList, QObject *parent = nullptr);
     ~Client();
@@ -47,9 +73,16 @@ public:
     QStringList watchedSubsystems() const;
     void setWatchedSubsystems(const QStringList &subsystemList);
 
+    MonitorMode monitorMode() const;
+    void setMonitorMode(MonitorMode mode);
+
+    MonitorStatistics monitorStatistics() const;
+    void resetMonitorStatistics();
+
     DeviceList allDevices();
     DeviceList devicesByProperty(const QString &property, const QVariant &value);
     DeviceList devicesBySubsystem(const QString &subsystem);
+    DeviceList devicesBySubsystems(const QStringList &subsystemList);
     Device deviceByDeviceFile(const QString &deviceFile);
     Device deviceBySysfsPath(const QString &sysfsPath);
     Device deviceBySubsystemAndName(const QString &subsystem, const QString &name);
@@ -64,6 +97,7 @@ Q_SIGNALS:
 private:
     friend class ClientPrivate;
     Q_PRIVATE_SLOT(d, void _uq_monitorReadyRead(int fd))
+    Q_PRIVATE_SLOT(d, void _uq_drainMonitorQueue())
     ClientPrivate *d;
 };
 
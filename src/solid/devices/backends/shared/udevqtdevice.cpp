@@ -20,14 +20,16 @@
 
 #include "udevqtdevice.h"
 #include "udevqt_p.h"
+#include "sysfsfile.h"
 
 #include <QtCore/QByteArray>
+#include <QtCore/QFileInfo>
 
 namespace UdevQt
 {
 
 DevicePrivate::DevicePrivate(struct udev_device *udev_, bool ref)
-    : udev(udev_)
+    : udev(udev_), snapshotBuilt(false)
 {
     if (ref) {
         udev_device_ref(udev);
@@ -43,6 +45,8 @@ DevicePrivate &DevicePrivate::operator=(const DevicePrivate &other)
 {
     udev_device_unref(udev);
     udev = udev_device_ref(other.udev);
+    snapshot = other.snapshot;
+    snapshotBuilt = other.snapshotBuilt;
     return *this;
 }
 
@@ -85,6 +89,8 @@ Device::Device(const Device &other)
 {
     if (other.d) {
         d = new DevicePrivate(other.d->udev);
+        d->snapshot = other.d->snapshot;
+        d->snapshotBuilt = other.d->snapshotBuilt;
     } else {
         d = nullptr;
     }
@@ -112,6 +118,8 @@ Device &Device::operator=(const Device &other)
     }
     if (!d) {
         d = new DevicePrivate(other.d->udev);
+        d->snapshot = other.d->snapshot;
+        d->snapshotBuilt = other.d->snapshotBuilt;
     } else {
         *d = *other.d;
     }
@@ -261,14 +269,34 @@ QString Device::decodedDeviceProperty(const QString &name) const
     return d->decodePropertyValue(udev_device_get_property_value(d->udev, propName.constData()));
 }
 
+// libudev keeps the first value it read for the lifetime of a udev_device,
+// devices are long-lived here, so attributes are read from sysfs every time
+static QString readSysattr(struct udev_device *udev, const QString &name)
+{
+    const QString path = QString::fromLatin1(udev_device_get_syspath(udev)) + QLatin1Char('/') + name;
+    const QFileInfo info(path);
+    if (info.isSymLink()) {
+        // like libudev, only these links are attributes: their value is the name they point to
+        if (name == QLatin1String("driver") || name == QLatin1String("subsystem") || name == QLatin1String("module")) {
+            return QFileInfo(info.symLinkTarget()).fileName();
+        }
+        return QString();
+    }
+    if (!info.isFile()) {
+        return QString();
+    }
+
+    Solid::Backends::Shared::SysfsFile file(path);
+    return QString::fromLatin1(file.read());
+}
+
 QVariant Device::sysfsProperty(const QString &name) const
 {
     if (!d) {
         return QVariant();
     }
 
-    QByteArray propName = name.toLatin1();
-    QString propValue = QString::fromLatin1(udev_device_get_sysattr_value(d->udev, propName.constData()));
+    QString propValue = readSysattr(d->udev, name);
     if (!propValue.isEmpty()) {
         return QVariant::fromValue(propValue);
     }
@@ -291,4 +319,48 @@ Device Device::ancestorOfType(const QString &subsys, const QString &devtype) con
     return Device(new DevicePrivate(p));
 }
 
+QLatin1String Device::subsystemLatin1() const
+{
+    if (!d) {
+        return QLatin1String();
+    }
+
+    return QLatin1String(udev_device_get_subsystem(d->udev));
+}
+
+QLatin1String Device::devicePropertyLatin1(const char *name) const
+{
+    if (!d) {
+        return QLatin1String();
+    }
+
+    return QLatin1String(udev_device_get_property_value(d->udev, name));
+}
+
+QLatin1String Device::sysfsPropertyLatin1(const char *name) const
+{
+    if (!d) {
+        return QLatin1String();
+    }
+
+    return QLatin1String(udev_device_get_sysattr_value(d->udev, name));
+}
+
+PropertyMap Device::properties() const
+{
+    if (!d) {
+        return PropertyMap();
+    }
+
+    if (!d->snapshotBuilt) {
+        struct udev_list_entry *entry;
+        udev_list_entry_foreach(entry, udev_device_get_properties_list_entry(d->udev)) {
+            d->snapshot.insert(QByteArray(udev_list_entry_get_name(entry)),
+                               QByteArray(udev_list_entry_get_value(entry)));
+        }
+        d->snapshotBuilt = true;
+    }
+    return d->snapshot;
+}
+
 }
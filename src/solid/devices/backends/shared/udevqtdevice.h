@@ -22,6 +22,8 @@
 #define UDEVQTDEVICE_H
 
 #include <QtCore/QObject>
+#include <QtCore/QByteArray>
+#include <QtCore/QMap>
 #include <QtCore/QList>
 #include <QtCore/QString>
 #include <QtCore/QStringList>
@@ -30,6 +32,9 @@
 namespace UdevQt
 {
 
+// udev property names and their raw (still encoded) values
+typedef QMap<QByteArray, QByteArray> PropertyMap;
+
 class DevicePrivate;
 class Device
 {
@@ -61,10 +66,23 @@ public:
     QVariant sysfsProperty(const QString &name) const;
     Device ancestorOfType(const QString &subsys, const QString &devtype) const;
 
+    // Allocation-free variants for hot paths. The returned views point into
+    // libudev's copy of the data and stay valid as long as this Device does.
+    // Unlike sysfsProperty(), sysfsPropertyLatin1() returns the value libudev
+    // read first, so it only suits attributes that never change.
+    QLatin1String subsystemLatin1() const;
+    QLatin1String devicePropertyLatin1(const char *name) const;
+    QLatin1String sysfsPropertyLatin1(const char *name) const;
+
+    // all udev properties, read once per device and shared by its copies;
+    // a device's properties never change, "change" events bring a new device
+    PropertyMap properties() const;
+
 private:
     Device(DevicePrivate *devPrivate);
     friend class Client;
     friend class ClientPrivate;
+    friend class DeviceCacheData;
 
     DevicePrivate *d;
 };
@@ -0,0 +1,243 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "udevqtdevicecache.h"
+#include "udevqt_p.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QThreadStorage>
+#include <qplatformdefs.h>
+
+namespace UdevQt
+{
+
+// a device node changes identity with every hotplug, so a small bound is
+// plenty; beyond it the cache simply starts over
+static const int s_maxCachedDevices = 1024;
+
+/*
+ * libudev is not thread-safe: neither contexts nor udev_device handles may be
+ * used by several threads at once. Each thread therefore looks devices up in
+ * a context of its own and keeps its own handles, only the invalidation
+ * bookkeeping is shared. An entry is valid as long as neither its device
+ * number nor the cache as a whole has been invalidated since it was looked up.
+ * Devices obtained from the cache must not outlive the thread they were
+ * looked up on.
+ */
+class DeviceCacheData
+{
+public:
+    struct Entry {
+        Device device;
+        quint32 generation;
+        quint32 epoch;
+    };
+
+    struct ThreadData {
+        ThreadData()
+            : udev(udev_new())
+        {
+        }
+
+        ~ThreadData()
+        {
+            devices.clear();
+            udev_unref(udev);
+        }
+
+        struct udev *udev;
+        QHash<quint64, Entry> devices;
+    };
+
+    DeviceCacheData()
+        : epoch(0)
+    {
+    }
+
+    static quint64 key(char type, dev_t devnum)
+    {
+        return (quint64(type == 'b' ? 1 : 0) << 63) | quint64(devnum);
+    }
+
+    static quint64 keyForDevice(const Device &device)
+    {
+        if (!device.isValid()) {
+            return 0;
+        }
+        struct udev_device *ud = device.d->udev;
+        const dev_t devnum = udev_device_get_devnum(ud);
+        if (devnum == 0) {
+            return 0;
+        }
+        return key(qstrcmp(udev_device_get_subsystem(ud), "block") == 0 ? 'b' : 'c', devnum);
+    }
+
+    static Device wrap(struct udev_device *ud)
+    {
+        return Device(new DevicePrivate(ud, false));
+    }
+
+    void invalidate(quint64 key)
+    {
+        QMutexLocker locker(&lock);
+        ++generations[key];
+    }
+
+    QMutex lock;
+    QHash<quint64, quint32> generations;
+    quint32 epoch;
+
+    QThreadStorage<ThreadData *> threads;
+};
+
+Q_GLOBAL_STATIC(DeviceCacheData, s_cache)
+
+static DeviceCacheData::ThreadData *threadData(DeviceCacheData *cache)
+{
+    if (!cache->threads.hasLocalData()) {
+        cache->threads.setLocalData(new DeviceCacheData::ThreadData);
+    }
+    return cache->threads.localData();
+}
+
+Device DeviceCache::deviceByDeviceFile(const QString &deviceFile)
+{
+    QT_STATBUF sb;
+
+    if (QT_STAT(deviceFile.toLatin1().constData(), &sb) != 0) {
+        return Device();
+    }
+
+    char type;
+    if (S_ISBLK(sb.st_mode)) {
+        type = 'b';
+    } else if (S_ISCHR(sb.st_mode)) {
+        type = 'c';
+    } else {
+        return Device();
+    }
+
+    DeviceCacheData *cache = s_cache();
+    const quint64 key = DeviceCacheData::key(type, sb.st_rdev);
+
+    quint32 generation;
+    quint32 epoch;
+    {
+        QMutexLocker locker(&cache->lock);
+        generation = cache->generations.value(key);
+        epoch = cache->epoch;
+    }
+
+    DeviceCacheData::ThreadData *thread = threadData(cache);
+    QHash<quint64, DeviceCacheData::Entry> &devices = thread->devices;
+    QHash<quint64, DeviceCacheData::Entry>::const_iterator it = devices.constFind(key);
+    if (it != devices.constEnd() && it->generation == generation && it->epoch == epoch) {
+        return it->device;
+    }
+
+    struct udev_device *ud = udev_device_new_from_devnum(thread->udev, type, sb.st_rdev);
+    if (!ud) {
+        devices.remove(key);
+        return Device();
+    }
+    // initialize the properties DB up front, see #298416
+    udev_device_get_properties_list_entry(ud);
+
+    if (devices.size() >= s_maxCachedDevices) {
+        devices.clear();
+    }
+    DeviceCacheData::Entry entry;
+    entry.device = DeviceCacheData::wrap(ud);
+    entry.generation = generation;
+    entry.epoch = epoch;
+    devices.insert(key, entry);
+    return entry.device;
+}
+
+void DeviceCache::update(const Device &device)
+{
+    const quint64 key = DeviceCacheData::keyForDevice(device);
+    if (!key || !s_cache.exists()) {
+        return;
+    }
+
+    DeviceCacheData *cache = s_cache();
+    cache->invalidate(key);
+
+    // the freshly received device is as good as a new lookup for this thread
+    if (cache->threads.hasLocalData()) {
+        QHash<quint64, DeviceCacheData::Entry> &devices = cache->threads.localData()->devices;
+        QHash<quint64, DeviceCacheData::Entry>::iterator it = devices.find(key);
+        if (it != devices.end()) {
+            QMutexLocker locker(&cache->lock);
+            it->device = device;
+            it->generation = cache->generations.value(key);
+            it->epoch = cache->epoch;
+        }
+    }
+}
+
+void DeviceCache::remove(const Device &device)
+{
+    const quint64 key = DeviceCacheData::keyForDevice(device);
+    if (!key || !s_cache.exists()) {
+        return;
+    }
+
+    s_cache()->invalidate(key);
+}
+
+void DeviceCache::invalidate(const QString &deviceFile)
+{
+    if (!s_cache.exists()) {
+        return;
+    }
+
+    QT_STATBUF sb;
+    if (QT_STAT(deviceFile.toLatin1().constData(), &sb) != 0 || !(S_ISBLK(sb.st_mode) || S_ISCHR(sb.st_mode))) {
+        return;
+    }
+
+    s_cache()->invalidate(DeviceCacheData::key(S_ISBLK(sb.st_mode) ? 'b' : 'c', sb.st_rdev));
+}
+
+void DeviceCache::clear()
+{
+    if (!s_cache.exists()) {
+        return;
+    }
+
+    DeviceCacheData *cache = s_cache();
+    QMutexLocker locker(&cache->lock);
+    ++cache->epoch;
+    cache->generations.clear();
+}
+
+int DeviceCache::count()
+{
+    if (!s_cache.exists() || !s_cache()->threads.hasLocalData()) {
+        return 0;
+    }
+
+    return s_cache()->threads.localData()->devices.size();
+}
+
+}
@@ -0,0 +1,57 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDEVQTDEVICECACHE_H
+#define UDEVQTDEVICECACHE_H
+
+#include <QtCore/QString>
+
+#include "udevqtdevice.h"
+
+namespace UdevQt
+{
+
+/**
+ * Process-wide cache of udev devices keyed by device number.
+ *
+ * Each thread looks devices up in a libudev context of its own, so backends
+ * that merely need a few udev properties of a device node don't create and
+ * tear down a context per lookup. Entries are refreshed or dropped by the
+ * monitors of every UdevQt::Client and can be invalidated explicitly by
+ * backends that learn about changes through other channels.
+ */
+class DeviceCache
+{
+public:
+    static Device deviceByDeviceFile(const QString &deviceFile);
+
+    // replaces a cached entry with a freshly received device, if present
+    static void update(const Device &device);
+    static void remove(const Device &device);
+    static void invalidate(const QString &deviceFile);
+    static void clear();
+
+    // number of handles cached for the calling thread
+    static int count();
+};
+
+}
+
+#endif
@@ -20,10 +20,7 @@
 
 #include "cpuinfo.h"
 
-#include <QtCore/QDebug>
 #include <QtCore/QFile>
-#include <QtCore/QRegExp>
-#include <QtCore/QStringList>
 
 namespace Solid
 {
@@ -32,92 +29,120 @@ namespace Backends
 namespace UDev
 {
 
-class CpuInfo
-{
-public:
-    CpuInfo();
-    QString extractCpuInfoLine(int processorNumber, const QString &regExpStr);
-    QString extractInfoLine(const QString &regExpStr);
+// /proc/cpuinfo changes only in "cpu MHz"; re-reading it for every query of a
+// 256-thread host would still be wasteful
+static const int s_speedRefreshInterval = 1000;
 
-private:
-    QStringList cpuInfo;
-};
+Q_GLOBAL_STATIC(CpuInfo, s_cpuInfo)
 
-QString extractCpuVendor(int processorNumber) {
-    CpuInfo info;
-    QString vendor = info.extractCpuInfoLine(processorNumber, "vendor_id\\s+:\\s+(\\S.+)");
+CpuInfo *CpuInfo::instance()
+{
+    return s_cpuInfo();
+}
 
-    if (vendor.isEmpty()) {
-        vendor = info.extractInfoLine("Hardware\\s+:\\s+(\\S.+)");
-    }
+CpuInfo::CpuInfo()
+{
+    parse(false);
+}
 
-    return vendor;
+QString CpuInfo::vendor(int processorNumber)
+{
+    QMutexLocker locker(&m_lock);
+    identify(processorNumber);
+    const QString vendor = m_records.value(processorNumber).vendor;
+    return vendor.isEmpty() ? m_hardware : vendor;
 }
 
-QString extractCpuModel(int processorNumber) {
-    CpuInfo info;
-    QString model = info.extractCpuInfoLine(processorNumber, "model name\\s+:\\s+(\\S.+)");
+QString CpuInfo::model(int processorNumber)
+{
+    QMutexLocker locker(&m_lock);
+    identify(processorNumber);
+    const QString model = m_records.value(processorNumber).model;
+    return model.isEmpty() ? m_processor : model;
+}
 
-    if (model.isEmpty()) {
-        model = info.extractInfoLine("Processor\\s+:\\s+(\\S.+)");
+int CpuInfo::currentSpeed(int processorNumber)
+{
+    QMutexLocker locker(&m_lock);
+    if (!m_speedAge.isValid() || m_speedAge.elapsed() >= s_speedRefreshInterval) {
+        parse(true);
     }
-
-    return model;
+    return m_records.value(processorNumber).currentSpeed;
 }
 
-int extractCurrentCpuSpeed(int processorNumber) {
-    CpuInfo info;
-    int speed = info.extractCpuInfoLine(processorNumber, "cpu MHz\\s+:\\s+(\\d+).*").toInt();
-    return speed;
+void CpuInfo::identify(int processorNumber)
+{
+    if (m_records.value(processorNumber).identified) {
+        return;
+    }
+    // don't rescan for every query about a processor that doesn't exist
+    if (m_identityAge.isValid() && m_identityAge.elapsed() < s_speedRefreshInterval) {
+        return;
+    }
+    parse(false);
 }
 
+void CpuInfo::parse(bool speedsOnly)
+{
+    m_speedAge.start();
+    if (!speedsOnly) {
+        m_identityAge.start();
+    }
 
-CpuInfo::CpuInfo() {
     QFile cpuInfoFile("/proc/cpuinfo");
     if (!cpuInfoFile.open(QIODevice::ReadOnly)) {
         return;
     }
-    cpuInfo = QString(cpuInfoFile.readAll()).split('\n', QString::SkipEmptyParts);
-}
-
-QString CpuInfo::extractCpuInfoLine(int processorNumber, const QString &regExpStr)
-{
-    const QRegExp processorRegExp("processor\\s+:\\s+(\\d+)");
-    const QRegExp regExp(regExpStr);
-
-    int line = 0;
-    while (line < cpuInfo.size()) {
-        if (processorRegExp.exactMatch(cpuInfo.at(line))) {
-            int recordProcNum = processorRegExp.capturedTexts()[1].toInt();
-            if (recordProcNum == processorNumber) {
-                ++line;
-                while (line < cpuInfo.size()) {
-                    if (regExp.exactMatch(cpuInfo.at(line))) {
-                        return regExp.capturedTexts()[1];
-                    }
-                    ++line;
+    const QByteArray cpuInfo = cpuInfoFile.readAll();
+
+    Record *record = nullptr;
+    int start = 0;
+    while (start < cpuInfo.size()) {
+        int end = cpuInfo.indexOf('\n', start);
+        if (end < 0) {
+            end = cpuInfo.size();
+        }
+        const int colon = cpuInfo.indexOf(':', start);
+        if (colon > start && colon < end) {
+            const QByteArray key = cpuInfo.mid(start, colon - start).trimmed();
+            const QByteArray value = cpuInfo.mid(colon + 1, end - colon - 1).trimmed();
+
+            if (key == "processor") {
+                bool ok;
+                const int number = value.toInt(&ok);
+                // only numbered entries start a processor record
+                record = ok ? &m_records[number] : nullptr;
+                if (record && !speedsOnly) {
+                    record->identified = true;
+                }
+            } else if (key == "cpu MHz") {
+                if (record) {
+                    record->currentSpeed = int(value.toDouble());
+                }
+            } else if (speedsOnly) {
+                // nothing else changes at runtime
+            } else if (key == "vendor_id") {
+                if (record) {
+                    record->vendor = QString::fromLatin1(value);
+                }
+            } else if (key == "model name") {
+                if (record) {
+                    record->model = QString::fromLatin1(value);
+                }
+            } else if (key == "Hardware") {
+                if (m_hardware.isEmpty()) {
+                    m_hardware = QString::fromLatin1(value);
+                }
+            } else if (key == "Processor") {
+                if (m_processor.isEmpty()) {
+                    m_processor = QString::fromLatin1(value);
                 }
             }
         }
-        ++line;
+        start = end + 1;
     }
-
-    return QString();
-}
-
-QString CpuInfo::extractInfoLine(const QString &regExpStr)
-{
-    const QRegExp regExp(regExpStr);
-
-    foreach (const QString &line, cpuInfo) {
-        if (regExp.exactMatch(line)) {
-            return regExp.capturedTexts()[1];
-        }
-    }
-    return QString();
 }
 
-
 }
 }
 }
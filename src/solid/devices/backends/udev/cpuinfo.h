@@ -21,6 +21,9 @@
 #ifndef SOLID_BACKENDS_UDEV_CPUINFO_H
 #define SOLID_BACKENDS_UDEV_CPUINFO_H
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
 #include <QtCore/QString>
 
 namespace Solid
@@ -31,17 +34,45 @@ namespace UDev
 {
 
 /**
- * Extracts vendor from /proc/cpuinfo for a given processor
+ * The contents of /proc/cpuinfo, parsed once into a table keyed by processor
+ * number and shared by all processors. Only the current speed is re-read,
+ * and at most once per second. A processor missing from the table, e.g. one
+ * that was hot-plugged or brought online later, triggers another full pass,
+ * again at most once per second.
  */
-QString extractCpuVendor(int processorNumber);
-/**
- * Extracts model from /proc/cpuinfo for a given processor
- */
-QString extractCpuModel(int processorNumber);
-/**
- * Extracts speed from /proc/cpuinfo for a given processor
- */
-int extractCurrentCpuSpeed(int processorNumber);
+class CpuInfo
+{
+public:
+    static CpuInfo *instance();
+
+    QString vendor(int processorNumber);
+    QString model(int processorNumber);
+    int currentSpeed(int processorNumber);
+
+    CpuInfo();
+
+private:
+    struct Record {
+        Record() : currentSpeed(0), identified(false) {}
+
+        QString vendor;
+        QString model;
+        int currentSpeed;
+        // seen by a full pass, not just by a speed refresh
+        bool identified;
+    };
+
+    void identify(int processorNumber);
+    void parse(bool speedsOnly);
+
+    QMutex m_lock;
+    QHash<int, Record> m_records;
+    // system-wide lines some architectures use instead of per-processor ones
+    QString m_hardware;
+    QString m_processor;
+    QElapsedTimer m_speedAge;
+    QElapsedTimer m_identityAge;
+};
 
 }
 }
@@ -20,15 +20,22 @@
 
 #include "udevblock.h"
 
+#include "../shared/blockqueue.h"
+#include "../shared/blockstatistics.h"
+
 using namespace Solid::Backends::UDev;
 
 Block::Block(UDevDevice *device)
     : DeviceInterface(device)
+    , m_statistics(nullptr)
+    , m_queue(nullptr)
 {
 }
 
 Block::~Block()
 {
+    delete m_statistics;
+    delete m_queue;
 }
 
 int Block::deviceMajor() const
@@ -46,3 +53,73 @@ QString Block::device() const
     return m_device->property("DEVNAME").toString();
 }
 
+Solid::Block::IoStatistics Block::ioStatistics() const
+{
+    if (!m_statistics) {
+        m_statistics = new Shared::BlockStatistics(deviceMajor(), deviceMinor());
+    }
+    return m_statistics->read();
+}
+
+const Solid::Backends::Shared::BlockQueue *Block::queue() const
+{
+    if (!m_queue) {
+        m_queue = new Shared::BlockQueue(deviceMajor(), deviceMinor());
+    }
+    return m_queue;
+}
+
+bool Block::isRotational() const
+{
+    return queue()->isRotational();
+}
+
+int Block::logicalBlockSize() const
+{
+    return queue()->logicalBlockSize();
+}
+
+int Block::physicalBlockSize() const
+{
+    return queue()->physicalBlockSize();
+}
+
+int Block::minimumIoSize() const
+{
+    return queue()->minimumIoSize();
+}
+
+int Block::optimalIoSize() const
+{
+    return queue()->optimalIoSize();
+}
+
+int Block::discardGranularity() const
+{
+    return queue()->discardGranularity();
+}
+
+Solid::Block::ZonedModel Block::zonedModel() const
+{
+    return queue()->zonedModel();
+}
+
+QString Block::scheduler() const
+{
+    return queue()->scheduler();
+}
+
+int Block::requestQueueSize() const
+{
+    return queue()->requestQueueSize();
+}
+
+int Block::readAheadSize() const
+{
+    return queue()->readAheadSize();
+}
+
+int Block::hardwareQueueCount() const
+{
+    return queue()->hardwareQueueCount();
+}
@@ -29,6 +29,12 @@ namespace Solid
 {
 namespace Backends
 {
+namespace Shared
+{
+class BlockQueue;
+class BlockStatistics;
+}
+
 namespace UDev
 {
 class Block : public DeviceInterface, virtual public Solid::Ifaces::Block
@@ -43,6 +49,24 @@ public:
     int deviceMajor() const Q_DECL_OVERRIDE;
     int deviceMinor() const Q_DECL_OVERRIDE;
     QString device() const Q_DECL_OVERRIDE;
+    Solid::Block::IoStatistics ioStatistics() const Q_DECL_OVERRIDE;
+    bool isRotational() const Q_DECL_OVERRIDE;
+    int logicalBlockSize() const Q_DECL_OVERRIDE;
+    int physicalBlockSize() const Q_DECL_OVERRIDE;
+    int minimumIoSize() const Q_DECL_OVERRIDE;
+    int optimalIoSize() const Q_DECL_OVERRIDE;
+    int discardGranularity() const Q_DECL_OVERRIDE;
+    Solid::Block::ZonedModel zonedModel() const Q_DECL_OVERRIDE;
+    QString scheduler() const Q_DECL_OVERRIDE;
+    int requestQueueSize() const Q_DECL_OVERRIDE;
+    int readAheadSize() const Q_DECL_OVERRIDE;
+    int hardwareQueueCount() const Q_DECL_OVERRIDE;
+
+private:
+    const Shared::BlockQueue *queue() const;
+
+    mutable Shared::BlockStatistics *m_statistics;
+    mutable Shared::BlockQueue *m_queue;
 };
 }
 }
@@ -25,11 +25,17 @@
 #include "udevcamera.h"
 #include "udevportablemediaplayer.h"
 #include "udevblock.h"
+#include "udevnetworkinterface.h"
+#include "udevsensor.h"
+#include "udevnumanode.h"
+#include "udevenergycounter.h"
 #include "cpuinfo.h"
 
 #include <sys/socket.h>
 #include <linux/if_arp.h>
 
+#include <solid/genericinterface.h>
+
 #include <QFile>
 #include <QDebug>
 
@@ -38,6 +44,7 @@ using namespace Solid::Backends::UDev;
 UDevDevice::UDevDevice(const UdevQt::Device device)
     : Solid::Ifaces::Device()
     , m_device(device)
+    , m_allPropertiesValid(false)
 {
 }
 
@@ -61,7 +68,7 @@ QString UDevDevice::vendor() const
     if (vendor.isEmpty()) {
         if (queryDeviceInterface(Solid::DeviceInterface::Processor)) {
             // sysfs doesn't have anything useful here
-            vendor = extractCpuVendor(deviceNumber());
+            vendor = CpuInfo::instance()->vendor(deviceNumber());
         }
 
         if (vendor.isEmpty()) {
@@ -77,7 +84,7 @@ QString UDevDevice::product() const
     if (product.isEmpty()) {
         if (queryDeviceInterface(Solid::DeviceInterface::Processor)) {
             // sysfs doesn't have anything useful here
-            product = extractCpuModel(deviceNumber());
+            product = CpuInfo::instance()->model(deviceNumber());
         }
 
         if (product.isEmpty()) {
@@ -100,6 +107,15 @@ QString UDevDevice::icon() const
         return QLatin1String("multimedia-player");
     } else if (queryDeviceInterface(Solid::DeviceInterface::Camera)) {
         return QLatin1String("camera-photo");
+    } else if (queryDeviceInterface(Solid::DeviceInterface::NetworkInterface)) {
+        return m_device.devicePropertyLatin1("DEVTYPE") == QLatin1String("wlan")
+               ? QLatin1String("network-wireless") : QLatin1String("network-wired");
+    } else if (queryDeviceInterface(Solid::DeviceInterface::Sensor)) {
+        return QLatin1String("temperature-normal");
+    } else if (queryDeviceInterface(Solid::DeviceInterface::NumaNode)) {
+        return QLatin1String("media-memory");
+    } else if (queryDeviceInterface(Solid::DeviceInterface::EnergyCounter)) {
+        return QLatin1String("battery-ac-adapter");
     }
 
     return QString();
@@ -132,6 +148,14 @@ QString UDevDevice::description() const
         }
     } else if (queryDeviceInterface(Solid::DeviceInterface::Camera)) {
         return tr("Camera");
+    } else if (queryDeviceInterface(Solid::DeviceInterface::NetworkInterface)) {
+        return tr("Network Interface");
+    } else if (queryDeviceInterface(Solid::DeviceInterface::Sensor)) {
+        return tr("Sensor");
+    } else if (queryDeviceInterface(Solid::DeviceInterface::NumaNode)) {
+        return tr("NUMA Node");
+    } else if (queryDeviceInterface(Solid::DeviceInterface::EnergyCounter)) {
+        return tr("Energy Counter");
     }
 
     return QString();
@@ -144,16 +168,33 @@ bool UDevDevice::queryDeviceInterface(const Solid::DeviceInterface::Type &type)
         return true;
 
     case Solid::DeviceInterface::Processor:
-        return m_device.subsystem() == QLatin1String("cpu");
+        return m_device.subsystemLatin1() == QLatin1String("cpu");
 
     case Solid::DeviceInterface::Camera:
-        return property("ID_GPHOTO2").toInt() == 1;
+        return m_device.devicePropertyLatin1("ID_GPHOTO2") == QLatin1String("1");
 
     case Solid::DeviceInterface::PortableMediaPlayer:
-        return !property("ID_MEDIA_PLAYER").toString().isEmpty();
+        return m_device.devicePropertyLatin1("ID_MEDIA_PLAYER").size() > 0;
 
     case Solid::DeviceInterface::Block:
-        return !property("MAJOR").toString().isEmpty();
+        return m_device.devicePropertyLatin1("MAJOR").size() > 0;
+
+    case Solid::DeviceInterface::NetworkInterface:
+        return m_device.subsystemLatin1() == QLatin1String("net");
+
+    case Solid::DeviceInterface::Sensor:
+        // cooling devices share the thermal subsystem with the zones
+        return m_device.subsystemLatin1() == QLatin1String("hwmon")
+               || (m_device.subsystemLatin1() == QLatin1String("thermal")
+                   && m_device.name().startsWith(QLatin1String("thermal_zone")));
+
+    case Solid::DeviceInterface::NumaNode:
+        return m_device.subsystemLatin1() == QLatin1String("node");
+
+    case Solid::DeviceInterface::EnergyCounter:
+        // the control types, like "intel-rapl" itself, have no counter
+        return m_device.subsystemLatin1() == QLatin1String("powercap")
+               && QFile::exists(m_device.sysfsPath() + QLatin1String("/energy_uj"));
 
     default:
         return false;
@@ -182,6 +223,18 @@ QObject *UDevDevice::createDeviceInterface(const Solid::DeviceInterface::Type &t
     case Solid::DeviceInterface::Block:
         return new Block(this);
 
+    case Solid::DeviceInterface::NetworkInterface:
+        return new NetworkInterface(this);
+
+    case Solid::DeviceInterface::Sensor:
+        return new Sensor(this);
+
+    case Solid::DeviceInterface::NumaNode:
+        return new NumaNode(this);
+
+    case Solid::DeviceInterface::EnergyCounter:
+        return new EnergyCounter(this);
+
     default:
         qFatal("Shouldn't happen");
         return nullptr;
@@ -204,16 +257,21 @@ QVariant UDevDevice::property(const QString &key) const
 
 QMap<QString, QVariant> UDevDevice::allProperties() const
 {
-    QMap<QString, QVariant> res;
-    Q_FOREACH (const QString &prop, m_device.deviceProperties()) {
-        res[prop] = property(prop);
+    if (!m_allPropertiesValid) {
+        const UdevQt::PropertyMap properties = m_device.properties();
+        UdevQt::PropertyMap::const_iterator it;
+        for (it = properties.constBegin(); it != properties.constEnd(); ++it) {
+            const QString key = QString::fromLatin1(it.key());
+            m_allProperties.insert(key, it.value().isEmpty() ? property(key) : QVariant(QString::fromLatin1(it.value())));
+        }
+        m_allPropertiesValid = true;
     }
-    return res;
+    return m_allProperties;
 }
 
 bool UDevDevice::propertyExists(const QString &key) const
 {
-    return m_device.deviceProperties().contains(key);
+    return m_device.properties().contains(key.toLatin1());
 }
 
 QString UDevDevice::systemAttribute(const char *attribute) const
@@ -240,3 +298,45 @@ UdevQt::Device UDevDevice::udevDevice()
 {
     return m_device;
 }
+
+void UDevDevice::updateDevice(const UdevQt::Device &device)
+{
+    if (!device.isValid()) {
+        return;
+    }
+
+    // the udev_device we hold is an immutable snapshot taken when it was
+    // received, so it serves as the reference the change is diffed against
+    const QMap<QString, QVariant> before = allProperties();
+    m_device = device;
+    m_allProperties.clear();
+    m_allPropertiesValid = false;
+    const QMap<QString, QVariant> after = allProperties();
+
+    // these describe the event rather than the device and differ every time
+    static const QStringList eventKeys = QStringList() << QStringLiteral("SEQNUM")
+                                         << QStringLiteral("ACTION") << QStringLiteral("DEVPATH_OLD");
+
+    QMap<QString, int> changes;
+    QMap<QString, QVariant>::const_iterator it;
+    for (it = after.constBegin(); it != after.constEnd(); ++it) {
+        if (eventKeys.contains(it.key())) {
+            continue;
+        }
+        QMap<QString, QVariant>::const_iterator old = before.constFind(it.key());
+        if (old == before.constEnd()) {
+            changes.insert(it.key(), Solid::GenericInterface::PropertyAdded);
+        } else if (old.value() != it.value()) {
+            changes.insert(it.key(), Solid::GenericInterface::PropertyModified);
+        }
+    }
+    for (it = before.constBegin(); it != before.constEnd(); ++it) {
+        if (!after.contains(it.key()) && !eventKeys.contains(it.key())) {
+            changes.insert(it.key(), Solid::GenericInterface::PropertyRemoved);
+        }
+    }
+
+    if (!changes.isEmpty()) {
+        emit propertyChanged(changes);
+    }
+}
@@ -71,8 +71,21 @@ public:
     int deviceNumber() const;
 
     UdevQt::Device udevDevice();
+
+    /**
+     * Replaces the wrapped udev device with the one carried by a "change"
+     * event and emits propertyChanged() for the udev properties that differ.
+     */
+    void updateDevice(const UdevQt::Device &device);
+
+Q_SIGNALS:
+    void propertyChanged(const QMap<QString, int> &changes);
+
 private:
     UdevQt::Device m_device;
+    // allProperties() of m_device, converted once
+    mutable QMap<QString, QVariant> m_allProperties;
+    mutable bool m_allPropertiesValid;
 };
 
 }
@@ -0,0 +1,61 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "udevenergycounter.h"
+#include "udevdevice.h"
+
+using namespace Solid::Backends::UDev;
+
+EnergyCounter::EnergyCounter(UDevDevice *device)
+    : DeviceInterface(device)
+    , m_zone(device->deviceName())
+{
+}
+
+EnergyCounter::~EnergyCounter()
+{
+}
+
+QString EnergyCounter::name() const
+{
+    return m_zone.name();
+}
+
+Solid::EnergyCounter::Domain EnergyCounter::domain() const
+{
+    return m_zone.domain();
+}
+
+qulonglong EnergyCounter::maxEnergyRange() const
+{
+    return m_zone.maxEnergyRange();
+}
+
+qulonglong EnergyCounter::energy() const
+{
+    return m_zone.energy();
+}
+
+bool EnergyCounter::isReadable() const
+{
+    bool ok;
+    m_zone.energy(&ok);
+    return ok;
+}
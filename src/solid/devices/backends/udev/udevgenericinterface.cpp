@@ -27,12 +27,8 @@ using namespace Solid::Backends::UDev;
 GenericInterface::GenericInterface(UDevDevice *device)
     : DeviceInterface(device)
 {
-#if 0
     connect(device, SIGNAL(propertyChanged(QMap<QString,int>)),
             this, SIGNAL(propertyChanged(QMap<QString,int>)));
-    connect(device, SIGNAL(conditionRaised(QString,QString)),
-            this, SIGNAL(conditionRaised(QString,QString)));
-#endif
 }
 
 GenericInterface::~GenericInterface()
@@ -22,12 +22,17 @@
 
 #include "udev.h"
 #include "udevdevice.h"
+#include "udevpressuredevice.h"
 #include "../shared/rootdevice.h"
 
 #include <QtCore/QSet>
+#include <QtCore/QHash>
 #include <QtCore/QFile>
+#include <QtCore/QPointer>
 #include <QtCore/QDebug>
 
+#include <algorithm>
+
 using namespace Solid::Backends::UDev;
 using namespace Solid::Backends::Shared;
 
@@ -39,24 +44,47 @@ public:
 
     bool isOfInterest(const QString &udi, const UdevQt::Device &device);
     bool checkOfInterest(const UdevQt::Device &device);
+    void enumerate();
+    UDevDevice *track(const QString &udi, UDevDevice *device);
 
     UdevQt::Client *m_client;
-    QStringList m_devicesOfInterest;
+    QStringList m_subsystems;
+    // udi -> device, filled by a single subsystem-filtered enumeration and
+    // kept current from the monitor's add/remove events afterwards
+    QHash<QString, UdevQt::Device> m_devicesOfInterest;
+    bool m_enumerated;
+    // backend objects handed out by createDevice(), to forward change events to
+    QHash<QString, QList<QPointer<UDevDevice> > > m_liveDevices;
+    // /proc/pressure has no udev counterpart and doesn't change at runtime
+    QStringList m_pressureUdis;
     QSet<Solid::DeviceInterface::Type> m_supportedInterfaces;
 };
 
 UDevManager::Private::Private()
+    : m_enumerated(false)
 {
-    QStringList subsystems;
-    subsystems << "processor";
-    subsystems << "cpu";
-    subsystems << "sound";
-    subsystems << "tty";
-    subsystems << "dvb";
-    subsystems << "net";
-    subsystems << "usb";
-    subsystems << "input";
-    m_client = new UdevQt::Client(subsystems);
+    m_subsystems << "processor";
+    m_subsystems << "cpu";
+    m_subsystems << "sound";
+    m_subsystems << "tty";
+    m_subsystems << "dvb";
+    m_subsystems << "net";
+    m_subsystems << "usb";
+    m_subsystems << "input";
+    m_subsystems << "hwmon";
+    m_subsystems << "thermal";
+    m_subsystems << "node";
+    m_subsystems << "powercap";
+
+    // SOLID_UDEV_MONITOR=thread drains the monitor on its own thread, so event
+    // storms reach us in batches rather than one event per wakeup
+    m_client = new UdevQt::Client;
+    if (qgetenv("SOLID_UDEV_MONITOR") == "thread") {
+        m_client->setMonitorMode(UdevQt::Client::ThreadedMonitor);
+    }
+    m_client->setWatchedSubsystems(m_subsystems);
+
+    m_pressureUdis = PressureDevice::availableUdis();
 }
 
 UDevManager::Private::~Private()
@@ -72,12 +100,36 @@ bool UDevManager::Private::isOfInterest(const QString &udi, const UdevQt::Device
 
     bool isOfInterest = checkOfInterest(device);
     if (isOfInterest) {
-        m_devicesOfInterest.append(udi);
+        m_devicesOfInterest.insert(udi, device);
     }
 
     return isOfInterest;
 }
 
+void UDevManager::Private::enumerate()
+{
+    if (m_enumerated) {
+        return;
+    }
+
+    // only the subsystems we monitor can yield devices of interest, so there
+    // is no point in instantiating every device known to sysfs
+    const QString prefix = QString::fromLatin1(UDEV_UDI_PREFIX);
+    const UdevQt::DeviceList deviceList = m_client->devicesBySubsystems(m_subsystems);
+    Q_FOREACH (const UdevQt::Device &device, deviceList) {
+        isOfInterest(prefix + device.sysfsPath(), device);
+    }
+    m_enumerated = true;
+}
+
+UDevDevice *UDevManager::Private::track(const QString &udi, UDevDevice *device)
+{
+    QList<QPointer<UDevDevice> > &devices = m_liveDevices[udi];
+    devices.removeAll(QPointer<UDevDevice>());
+    devices.append(device);
+    return device;
+}
+
 bool UDevManager::Private::checkOfInterest(const UdevQt::Device &device)
 {
 #ifdef UDEV_DETAILED_OUTPUT
@@ -91,41 +143,56 @@ bool UDevManager::Private::checkOfInterest(const UdevQt::Device &device)
     qDebug() << "Subsystem:" << device.subsystem();
     qDebug() << ">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>";
 #endif
-    if (device.subsystem() == QLatin1String("cpu")) {
+    // this runs for every enumerated and hotplugged device, so stick to
+    // views on libudev's own strings instead of converting each value
+    const QLatin1String subsystem = device.subsystemLatin1();
+    const QLatin1String one("1");
+
+    if (subsystem == QLatin1String("cpu")) {
         // Linux ACPI reports processor slots, rather than processors.
         // Empty slots will not have a system device associated with them.
         return QFile::exists(device.sysfsPath() + "/sysdev") || QFile::exists(device.sysfsPath() + "/cpufreq") || QFile::exists(device.sysfsPath() + "/topology/core_id");
     }
-    if (device.subsystem() == QLatin1String("sound") &&
-            device.deviceProperty("SOUND_FORM_FACTOR").toString() != "internal") {
+    if (subsystem == QLatin1String("sound") &&
+            device.devicePropertyLatin1("SOUND_FORM_FACTOR") != QLatin1String("internal")) {
         return true;
     }
 
-    if (device.subsystem() == QLatin1String("tty")) {
-        QString path = device.deviceProperty("DEVPATH").toString();
-
-        int lastSlash = path.length() - path.lastIndexOf(QLatin1String("/")) - 1;
-        QByteArray lastElement = path.right(lastSlash).toLatin1();
+    if (subsystem == QLatin1String("tty")) {
+        const QLatin1String devPath = device.devicePropertyLatin1("DEVPATH");
+        const QByteArray path = QByteArray::fromRawData(devPath.data(), devPath.size());
+        const char *lastElement = path.constData() + path.lastIndexOf('/') + 1;
 
-        if (lastElement.startsWith("tty") && !path.startsWith("/devices/virtual")) {
+        if (qstrncmp(lastElement, "tty", 3) == 0 && !path.startsWith("/devices/virtual")) {
             return true;
         }
     }
 
-    if (device.subsystem() == QLatin1String("input")) {
-        if (device.deviceProperty("ID_INPUT_MOUSE").toInt() == 1 ||
-                device.deviceProperty("ID_INPUT_TOUCHPAD").toInt() == 1 ||
-                device.deviceProperty("ID_INPUT_TABLET").toInt() == 1 ||
-                device.deviceProperty("ID_INPUT_TOUCHSCREEN").toInt() == 1) {
+    if (subsystem == QLatin1String("input")) {
+        if (device.devicePropertyLatin1("ID_INPUT_MOUSE") == one ||
+                device.devicePropertyLatin1("ID_INPUT_TOUCHPAD") == one ||
+                device.devicePropertyLatin1("ID_INPUT_TABLET") == one ||
+                device.devicePropertyLatin1("ID_INPUT_TOUCHSCREEN") == one) {
             return true;
         }
 
     }
 
-    return device.subsystem() == QLatin1String("dvb") ||
-           device.subsystem() == QLatin1String("net") ||
-           (!device.deviceProperty("ID_MEDIA_PLAYER").toString().isEmpty() && device.parent().deviceProperty("ID_MEDIA_PLAYER").toString().isEmpty()) || // media-player-info recognized devices
-           (device.deviceProperty("ID_GPHOTO2").toInt() == 1 && device.parent().deviceProperty("ID_GPHOTO2").toInt() != 1); // GPhoto2 cameras
+    if (subsystem == QLatin1String("dvb") || subsystem == QLatin1String("net")
+            || subsystem == QLatin1String("hwmon") || subsystem == QLatin1String("node")) {
+        return true;
+    }
+
+    if (subsystem == QLatin1String("thermal")) {
+        return device.name().startsWith(QLatin1String("thermal_zone"));
+    }
+
+    if (subsystem == QLatin1String("powercap")) {
+        return QFile::exists(device.sysfsPath() + "/energy_uj");
+    }
+
+    return (device.devicePropertyLatin1("ID_MEDIA_PLAYER").size() > 0 && device.parent().devicePropertyLatin1("ID_MEDIA_PLAYER").size() == 0) || // media-player-info recognized devices
+           (device.devicePropertyLatin1("ID_GPHOTO2") == one && device.parent().devicePropertyLatin1("ID_GPHOTO2") != one); // GPhoto2 cameras
 }
 
 UDevManager::UDevManager(QObject *parent)
@@ -134,12 +201,18 @@ UDevManager::UDevManager(QObject *parent)
 {
     connect(d->m_client, SIGNAL(deviceAdded(UdevQt::Device)), this, SLOT(slotDeviceAdded(UdevQt::Device)));
     connect(d->m_client, SIGNAL(deviceRemoved(UdevQt::Device)), this, SLOT(slotDeviceRemoved(UdevQt::Device)));
+    connect(d->m_client, SIGNAL(deviceChanged(UdevQt::Device)), this, SLOT(slotDeviceChanged(UdevQt::Device)));
 
     d->m_supportedInterfaces << Solid::DeviceInterface::GenericInterface
                              << Solid::DeviceInterface::Processor
                              << Solid::DeviceInterface::Camera
                              << Solid::DeviceInterface::PortableMediaPlayer
                              << Solid::DeviceInterface::Block
+                             << Solid::DeviceInterface::NetworkInterface
+                             << Solid::DeviceInterface::Sensor
+                             << Solid::DeviceInterface::NumaNode
+                             << Solid::DeviceInterface::EnergyCounter
+                             << Solid::DeviceInterface::Pressure
                              ;
 }
 
@@ -160,13 +233,11 @@ QSet<Solid::DeviceInterface::Type> UDevManager::supportedInterfaces() const
 
 QStringList UDevManager::allDevices()
 {
-    QStringList res;
-    const UdevQt::DeviceList deviceList = d->m_client->allDevices();
-    Q_FOREACH (const UdevQt::Device &device, deviceList) {
-        if (d->isOfInterest(udiPrefix() + device.sysfsPath(), device)) {
-            res << udiPrefix() + device.sysfsPath();
-        }
-    }
+    d->enumerate();
+
+    QStringList res = d->m_devicesOfInterest.keys();
+    res += d->m_pressureUdis;
+    std::sort(res.begin(), res.end());
     return res;
 }
 
@@ -176,9 +247,20 @@ QStringList UDevManager::devicesFromQuery(const QString &parentUdi,
     QStringList allDev = allDevices();
     QStringList result;
 
+    if (type == Solid::DeviceInterface::Pressure) {
+        if (parentUdi.isEmpty() || parentUdi == udiPrefix()) {
+            result = d->m_pressureUdis;
+        }
+        return result;
+    }
+
     if (!parentUdi.isEmpty()) {
         Q_FOREACH (const QString &udi, allDev) {
-            UDevDevice device(d->m_client->deviceBySysfsPath(udi.right(udi.size() - udiPrefix().size())));
+            if (d->m_pressureUdis.contains(udi)) {
+                // they have no interface but Pressure
+                continue;
+            }
+            UDevDevice device(d->m_devicesOfInterest.value(udi));
             if (device.queryDeviceInterface(type) && device.parentUdi() == parentUdi) {
                 result << udi;
             }
@@ -187,7 +269,10 @@ QStringList UDevManager::devicesFromQuery(const QString &parentUdi,
         return result;
     } else if (type != Solid::DeviceInterface::Unknown) {
         Q_FOREACH (const QString &udi, allDev) {
-            UDevDevice device(d->m_client->deviceBySysfsPath(udi.right(udi.size() - udiPrefix().size())));
+            if (d->m_pressureUdis.contains(udi)) {
+                continue;
+            }
+            UDevDevice device(d->m_devicesOfInterest.value(udi));
             if (device.queryDeviceInterface(type)) {
                 result << udi;
             }
@@ -210,11 +295,20 @@ QObject *UDevManager::createDevice(const QString &udi_)
         return device;
     }
 
+    if (d->m_pressureUdis.contains(udi_)) {
+        return new PressureDevice(udi_);
+    }
+
+    const QHash<QString, UdevQt::Device>::const_iterator it = d->m_devicesOfInterest.constFind(udi_);
+    if (it != d->m_devicesOfInterest.constEnd()) {
+        return d->track(udi_, new UDevDevice(it.value()));
+    }
+
     const QString udi = udi_.right(udi_.size() - udiPrefix().size());
     UdevQt::Device device = d->m_client->deviceBySysfsPath(udi);
 
     if (d->isOfInterest(udi_, device) || QFile::exists(udi)) {
-        return new UDevDevice(device);
+        return d->track(udi_, new UDevDevice(device));
     }
 
     return nullptr;
@@ -222,15 +316,55 @@ QObject *UDevManager::createDevice(const QString &udi_)
 
 void UDevManager::slotDeviceAdded(const UdevQt::Device &device)
 {
-    if (d->isOfInterest(udiPrefix() + device.sysfsPath(), device)) {
-        emit deviceAdded(udiPrefix() + device.sysfsPath());
+    const QString udi = udiPrefix() + device.sysfsPath();
+    if (d->checkOfInterest(device)) {
+        // replace any stale entry: the event carries the current properties
+        d->m_devicesOfInterest.insert(udi, device);
+        emit deviceAdded(udi);
     }
 }
 
 void UDevManager::slotDeviceRemoved(const UdevQt::Device &device)
 {
-    if (d->isOfInterest(udiPrefix() + device.sysfsPath(), device)) {
-        emit deviceRemoved(udiPrefix() + device.sysfsPath());
-        d->m_devicesOfInterest.removeAll(udiPrefix() + device.sysfsPath());
+    // a removed device may no longer carry the properties checkOfInterest()
+    // looks at, so rely on the interest set alone
+    const QString udi = udiPrefix() + device.sysfsPath();
+    d->m_liveDevices.remove(udi);
+    if (d->m_devicesOfInterest.remove(udi)) {
+        emit deviceRemoved(udi);
+    }
+}
+
+void UDevManager::slotDeviceChanged(const UdevQt::Device &device)
+{
+    const QString udi = udiPrefix() + device.sysfsPath();
+
+    if (!d->m_devicesOfInterest.contains(udi)) {
+        // a change can complete the properties that make a device interesting,
+        // e.g. input capabilities tagged after the initial "add"
+        if (d->checkOfInterest(device)) {
+            d->m_devicesOfInterest.insert(udi, device);
+            emit deviceAdded(udi);
+        }
+        return;
+    }
+
+    d->m_devicesOfInterest.insert(udi, device);
+
+    QHash<QString, QList<QPointer<UDevDevice> > >::iterator it = d->m_liveDevices.find(udi);
+    if (it == d->m_liveDevices.end()) {
+        return;
+    }
+    it->removeAll(QPointer<UDevDevice>());
+    if (it->isEmpty()) {
+        d->m_liveDevices.erase(it);
+        return;
+    }
+    // copy: a receiver may trigger the creation of another backend object
+    const QList<QPointer<UDevDevice> > devices = *it;
+    Q_FOREACH (const QPointer<UDevDevice> &live, devices) {
+        if (live) {
+            live->updateDevice(device);
+        }
     }
 }
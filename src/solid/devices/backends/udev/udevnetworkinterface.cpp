@@ -0,0 +1,203 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "udevnetworkinterface.h"
+#include "udevdevice.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+
+using namespace Solid::Backends::UDev;
+
+NetworkInterface::NetworkInterface(UDevDevice *device)
+    : DeviceInterface(device)
+    , m_statisticsOpened(false)
+    , m_pcieLink(nullptr)
+{
+}
+
+NetworkInterface::~NetworkInterface()
+{
+    delete m_pcieLink;
+}
+
+QByteArray NetworkInterface::attribute(const char *name) const
+{
+    Shared::SysfsFile file(m_device->deviceName() + QLatin1Char('/') + QLatin1String(name));
+    return file.read();
+}
+
+int NetworkInterface::queueCount(const QString &prefix) const
+{
+    const QDir queues(m_device->deviceName() + QLatin1String("/queues"));
+    return queues.entryList(QStringList() << prefix + QLatin1Char('*'), QDir::Dirs | QDir::NoDotAndDotDot).count();
+}
+
+QString NetworkInterface::interfaceName() const
+{
+    const QString name = m_device->property("INTERFACE").toString();
+    if (!name.isEmpty()) {
+        return name;
+    }
+    return m_device->udevDevice().name();
+}
+
+QString NetworkInterface::hardwareAddress() const
+{
+    return QString::fromLatin1(attribute("address"));
+}
+
+bool NetworkInterface::isWireless() const
+{
+    return m_device->property("DEVTYPE").toString() == QLatin1String("wlan")
+           || QFileInfo::exists(m_device->deviceName() + QLatin1String("/wireless"));
+}
+
+int NetworkInterface::speed() const
+{
+    // reading fails with EINVAL while the link is down
+    bool ok;
+    const int speed = attribute("speed").toInt(&ok);
+    return ok && speed > 0 ? speed : -1;
+}
+
+Solid::NetworkInterface::Duplex NetworkInterface::duplex() const
+{
+    const QByteArray duplex = attribute("duplex");
+    if (duplex == "full") {
+        return Solid::NetworkInterface::FullDuplex;
+    } else if (duplex == "half") {
+        return Solid::NetworkInterface::HalfDuplex;
+    }
+    return Solid::NetworkInterface::UnknownDuplex;
+}
+
+int NetworkInterface::mtu() const
+{
+    return attribute("mtu").toInt();
+}
+
+bool NetworkInterface::hasCarrier() const
+{
+    return attribute("carrier") == "1";
+}
+
+Solid::NetworkInterface::OperationalState NetworkInterface::operationalState() const
+{
+    const QByteArray state = attribute("operstate");
+    if (state == "up") {
+        return Solid::NetworkInterface::Up;
+    } else if (state == "down") {
+        return Solid::NetworkInterface::Down;
+    } else if (state == "lowerlayerdown") {
+        return Solid::NetworkInterface::LowerLayerDown;
+    } else if (state == "dormant") {
+        return Solid::NetworkInterface::Dormant;
+    } else if (state == "testing") {
+        return Solid::NetworkInterface::Testing;
+    } else if (state == "notpresent") {
+        return Solid::NetworkInterface::NotPresent;
+    }
+    return Solid::NetworkInterface::UnknownState;
+}
+
+int NetworkInterface::rxQueueCount() const
+{
+    return queueCount(QStringLiteral("rx-"));
+}
+
+int NetworkInterface::txQueueCount() const
+{
+    return queueCount(QStringLiteral("tx-"));
+}
+
+void NetworkInterface::openStatistics() const
+{
+    if (m_statisticsOpened) {
+        return;
+    }
+    m_statisticsOpened = true;
+
+    static const char *const names[CounterCount] = {
+        "rx_bytes", "tx_bytes", "rx_packets", "tx_packets", "rx_errors", "tx_errors",
+        "rx_dropped", "tx_dropped", "multicast", "collisions"
+    };
+    const QString base = m_device->deviceName() + QLatin1String("/statistics/");
+    for (int i = 0; i < CounterCount; ++i) {
+        m_counters[i].setPath(base + QLatin1String(names[i]));
+    }
+}
+
+Solid::NetworkInterface::Statistics NetworkInterface::statistics() const
+{
+    openStatistics();
+
+    Solid::NetworkInterface::Statistics statistics;
+    qulonglong values[CounterCount];
+    for (int i = 0; i < CounterCount; ++i) {
+        bool ok;
+        values[i] = m_counters[i].readULongLong(&ok);
+        if (!ok) {
+            // the interface is gone
+            return statistics;
+        }
+    }
+
+    statistics.valid = true;
+    statistics.rxBytes = values[RxBytes];
+    statistics.txBytes = values[TxBytes];
+    statistics.rxPackets = values[RxPackets];
+    statistics.txPackets = values[TxPackets];
+    statistics.rxErrors = values[RxErrors];
+    statistics.txErrors = values[TxErrors];
+    statistics.rxDropped = values[RxDropped];
+    statistics.txDropped = values[TxDropped];
+    statistics.multicast = values[Multicast];
+    statistics.collisions = values[Collisions];
+    return statistics;
+}
+
+Solid::Backends::Shared::PcieLink *NetworkInterface::pcieLink() const
+{
+    if (!m_pcieLink) {
+        m_pcieLink = new Shared::PcieLink(m_device->deviceName());
+    }
+    return m_pcieLink;
+}
+
+double NetworkInterface::pcieLinkSpeed() const
+{
+    return pcieLink()->speed();
+}
+
+int NetworkInterface::pcieLinkWidth() const
+{
+    return pcieLink()->width();
+}
+
+double NetworkInterface::maxPcieLinkSpeed() const
+{
+    return pcieLink()->maxSpeed();
+}
+
+int NetworkInterface::maxPcieLinkWidth() const
+{
+    return pcieLink()->maxWidth();
+}
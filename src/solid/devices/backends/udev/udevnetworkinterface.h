@@ -0,0 +1,83 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_UDEV_NETWORKINTERFACE_H
+#define SOLID_BACKENDS_UDEV_NETWORKINTERFACE_H
+
+#include <solid/devices/ifaces/networkinterface.h>
+#include "udevdeviceinterface.h"
+#include "../shared/sysfsfile.h"
+#include "../shared/pcielink.h"
+
+namespace Solid
+{
+namespace Backends
+{
+namespace UDev
+{
+class UDevDevice;
+
+class NetworkInterface : public DeviceInterface, virtual public Solid::Ifaces::NetworkInterface
+{
+    Q_OBJECT
+    Q_INTERFACES(Solid::Ifaces::NetworkInterface)
+
+public:
+    NetworkInterface(UDevDevice *device);
+    virtual ~NetworkInterface();
+
+    QString interfaceName() const Q_DECL_OVERRIDE;
+    QString hardwareAddress() const Q_DECL_OVERRIDE;
+    bool isWireless() const Q_DECL_OVERRIDE;
+    int speed() const Q_DECL_OVERRIDE;
+    Solid::NetworkInterface::Duplex duplex() const Q_DECL_OVERRIDE;
+    int mtu() const Q_DECL_OVERRIDE;
+    bool hasCarrier() const Q_DECL_OVERRIDE;
+    Solid::NetworkInterface::OperationalState operationalState() const Q_DECL_OVERRIDE;
+    int rxQueueCount() const Q_DECL_OVERRIDE;
+    int txQueueCount() const Q_DECL_OVERRIDE;
+    Solid::NetworkInterface::Statistics statistics() const Q_DECL_OVERRIDE;
+    double pcieLinkSpeed() const Q_DECL_OVERRIDE;
+    int pcieLinkWidth() const Q_DECL_OVERRIDE;
+    double maxPcieLinkSpeed() const Q_DECL_OVERRIDE;
+    int maxPcieLinkWidth() const Q_DECL_OVERRIDE;
+
+private:
+    // libudev caches attribute values for the lifetime of the udev_device,
+    // link state has to be read from sysfs directly
+    QByteArray attribute(const char *name) const;
+    int queueCount(const QString &prefix) const;
+
+    enum Counter {
+        RxBytes, TxBytes, RxPackets, TxPackets, RxErrors, TxErrors,
+        RxDropped, TxDropped, Multicast, Collisions, CounterCount
+    };
+    void openStatistics() const;
+    mutable bool m_statisticsOpened;
+    mutable Shared::SysfsFile m_counters[CounterCount];
+
+    Shared::PcieLink *pcieLink() const;
+    mutable Shared::PcieLink *m_pcieLink;
+};
+}
+}
+}
+
+#endif // SOLID_BACKENDS_UDEV_NETWORKINTERFACE_H
@@ -0,0 +1,188 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "udevnumanode.h"
+#include "udevdevice.h"
+#include "../shared/memoryblocks.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QMap>
+#include <QtCore/QMetaMethod>
+
+using namespace Solid::Backends::UDev;
+
+static bool samePools(const Solid::NumaNode::HugePagePoolList &a, const Solid::NumaNode::HugePagePoolList &b)
+{
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (int i = 0; i < a.size(); ++i) {
+        if (a.at(i).pageSize != b.at(i).pageSize || a.at(i).total != b.at(i).total
+                || a.at(i).free != b.at(i).free || a.at(i).surplus != b.at(i).surplus) {
+            return false;
+        }
+    }
+    return true;
+}
+
+NumaNode::NumaNode(UDevDevice *device)
+    : DeviceInterface(device)
+    , m_meminfo(device->deviceName() + QLatin1String("/meminfo"))
+    , m_hugePagesOpened(false)
+{
+    m_pollTimer.setInterval(1000);
+    connect(&m_pollTimer, SIGNAL(timeout()), this, SLOT(pollHugePages()));
+}
+
+NumaNode::~NumaNode()
+{
+    qDeleteAll(m_pools);
+}
+
+int NumaNode::number() const
+{
+    return m_device->udevDevice().sysfsNumber();
+}
+
+QString NumaNode::cpuList() const
+{
+    Shared::SysfsFile file(m_device->deviceName() + QLatin1String("/cpulist"));
+    return QString::fromLatin1(file.read());
+}
+
+QList<int> NumaNode::distances() const
+{
+    Shared::SysfsFile file(m_device->deviceName() + QLatin1String("/distance"));
+
+    QList<int> distances;
+    Q_FOREACH (const QByteArray &distance, file.read().split(' ')) {
+        if (!distance.isEmpty()) {
+            distances << distance.toInt();
+        }
+    }
+    return distances;
+}
+
+qulonglong NumaNode::meminfo(const char *key) const
+{
+    // lines look like "Node 0 MemTotal:       16309448 kB"
+    const QByteArray contents = m_meminfo.read();
+    const QByteArray needle = QByteArray(" ") + key + ':';
+
+    const int start = contents.indexOf(needle);
+    if (start < 0) {
+        return 0;
+    }
+    int end = contents.indexOf('\n', start);
+    if (end < 0) {
+        end = contents.size();
+    }
+    const QByteArray value = contents.mid(start + needle.size(), end - start - needle.size()).trimmed();
+    return value.left(value.indexOf(' ')).toULongLong() * 1024;
+}
+
+qulonglong NumaNode::totalMemory() const
+{
+    return meminfo("MemTotal");
+}
+
+qulonglong NumaNode::freeMemory() const
+{
+    return meminfo("MemFree");
+}
+
+void NumaNode::openHugePages() const
+{
+    if (m_hugePagesOpened) {
+        return;
+    }
+    m_hugePagesOpened = true;
+
+    // the per node pools add up to the ones in /sys/kernel/mm/hugepages
+    const QString path = m_device->deviceName() + QLatin1String("/hugepages");
+    QMap<qulonglong, QString> pools;
+    Q_FOREACH (const QString &entry, QDir(path).entryList(QStringList() << QStringLiteral("hugepages-*kB"), QDir::Dirs)) {
+        bool ok;
+        const qulonglong pageSize = entry.midRef(10, entry.size() - 12).toULongLong(&ok) * 1024;
+        if (ok) {
+            pools.insert(pageSize, path + QLatin1Char('/') + entry);
+        }
+    }
+
+    for (QMap<qulonglong, QString>::const_iterator it = pools.constBegin(); it != pools.constEnd(); ++it) {
+        Pool *pool = new Pool;
+        pool->pageSize = it.key();
+        pool->total.setPath(it.value() + QLatin1String("/nr_hugepages"));
+        pool->free.setPath(it.value() + QLatin1String("/free_hugepages"));
+        pool->surplus.setPath(it.value() + QLatin1String("/surplus_hugepages"));
+        m_pools << pool;
+    }
+}
+
+Solid::NumaNode::HugePagePoolList NumaNode::hugePagePools() const
+{
+    openHugePages();
+
+    Solid::NumaNode::HugePagePoolList pools;
+    Q_FOREACH (Pool *pool, m_pools) {
+        Solid::NumaNode::HugePagePool hugePages;
+        hugePages.pageSize = pool->pageSize;
+        hugePages.total = pool->total.readLongLong();
+        hugePages.free = pool->free.readLongLong();
+        hugePages.surplus = pool->surplus.readLongLong();
+        pools << hugePages;
+    }
+    return pools;
+}
+
+int NumaNode::memoryBlockCount() const
+{
+    return Shared::MemoryBlocks::list(m_device->deviceName()).count();
+}
+
+int NumaNode::onlineMemoryBlockCount() const
+{
+    return Shared::MemoryBlocks::onlineCount(m_device->deviceName());
+}
+
+void NumaNode::connectNotify(const QMetaMethod &signal)
+{
+    if (signal == QMetaMethod::fromSignal(&NumaNode::hugePagesChanged) && !m_pollTimer.isActive()) {
+        m_lastPools = hugePagePools();
+        m_pollTimer.start();
+    }
+}
+
+void NumaNode::disconnectNotify(const QMetaMethod &signal)
+{
+    Q_UNUSED(signal)
+    if (!isSignalConnected(QMetaMethod::fromSignal(&NumaNode::hugePagesChanged))) {
+        m_pollTimer.stop();
+    }
+}
+
+void NumaNode::pollHugePages()
+{
+    const Solid::NumaNode::HugePagePoolList pools = hugePagePools();
+    if (!samePools(pools, m_lastPools)) {
+        m_lastPools = pools;
+        emit hugePagesChanged(m_device->udi());
+    }
+}
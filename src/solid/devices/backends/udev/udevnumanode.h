@@ -0,0 +1,90 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_UDEV_NUMANODE_H
+#define SOLID_BACKENDS_UDEV_NUMANODE_H
+
+#include <solid/devices/ifaces/numanode.h>
+#include "udevdeviceinterface.h"
+#include "../shared/sysfsfile.h"
+
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+namespace Solid
+{
+namespace Backends
+{
+namespace UDev
+{
+class UDevDevice;
+
+class NumaNode : public DeviceInterface, virtual public Solid::Ifaces::NumaNode
+{
+    Q_OBJECT
+    Q_INTERFACES(Solid::Ifaces::NumaNode)
+
+public:
+    NumaNode(UDevDevice *device);
+    virtual ~NumaNode();
+
+    int number() const Q_DECL_OVERRIDE;
+    QString cpuList() const Q_DECL_OVERRIDE;
+    QList<int> distances() const Q_DECL_OVERRIDE;
+    qulonglong totalMemory() const Q_DECL_OVERRIDE;
+    qulonglong freeMemory() const Q_DECL_OVERRIDE;
+    Solid::NumaNode::HugePagePoolList hugePagePools() const Q_DECL_OVERRIDE;
+    int memoryBlockCount() const Q_DECL_OVERRIDE;
+    int onlineMemoryBlockCount() const Q_DECL_OVERRIDE;
+
+Q_SIGNALS:
+    void hugePagesChanged(const QString &udi) Q_DECL_OVERRIDE;
+
+protected:
+    void connectNotify(const QMetaMethod &signal) Q_DECL_OVERRIDE;
+    void disconnectNotify(const QMetaMethod &signal) Q_DECL_OVERRIDE;
+
+private Q_SLOTS:
+    void pollHugePages();
+
+private:
+    struct Pool {
+        qulonglong pageSize;
+        Shared::SysfsFile total;
+        Shared::SysfsFile free;
+        Shared::SysfsFile surplus;
+    };
+
+    qulonglong meminfo(const char *key) const;
+    void openHugePages() const;
+
+    mutable Shared::SysfsFile m_meminfo;
+    mutable bool m_hugePagesOpened;
+    mutable QVector<Pool *> m_pools;
+    // the kernel doesn't notify about pool changes, they are polled while
+    // hugePagesChanged() is connected
+    QTimer m_pollTimer;
+    Solid::NumaNode::HugePagePoolList m_lastPools;
+};
+}
+}
+}
+
+#endif // SOLID_BACKENDS_UDEV_NUMANODE_H
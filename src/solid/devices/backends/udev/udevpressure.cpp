@@ -0,0 +1,98 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "udevpressure.h"
+#include "udevpressuredevice.h"
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QSocketNotifier>
+#include <qplatformdefs.h>
+
+using namespace Solid::Backends::UDev;
+
+Pressure::Pressure(PressureDevice *device)
+    : QObject(device)
+    , m_udi(device->udi())
+    , m_stall(device->path())
+    , m_nextTrigger(0)
+{
+}
+
+Pressure::~Pressure()
+{
+    // the notifiers are our children, but the descriptors are ours to close;
+    // unregister each notifier before its descriptor goes away
+    Q_FOREACH (int id, m_triggers.keys()) {
+        removeTrigger(id);
+    }
+}
+
+Solid::Pressure::Resource Pressure::resource() const
+{
+    return Shared::PressureStall::resourceFromName(QFileInfo(m_stall.path()).fileName());
+}
+
+Solid::Pressure::Stall Pressure::stall(Solid::Pressure::StallType type) const
+{
+    Solid::Pressure::Stall some;
+    Solid::Pressure::Stall full;
+    if (!m_stall.read(&some, &full)) {
+        return Solid::Pressure::Stall();
+    }
+    return type == Solid::Pressure::Full ? full : some;
+}
+
+int Pressure::addTrigger(Solid::Pressure::StallType type, qulonglong threshold, qulonglong window)
+{
+    const int fd = m_stall.openTrigger(type, threshold, window);
+    if (fd < 0) {
+        return -1;
+    }
+
+    // the kernel flags a crossed threshold with POLLPRI, which the event
+    // loop watches for exception notifiers; no polling on our side
+    QSocketNotifier *notifier = new QSocketNotifier(fd, QSocketNotifier::Exception, this);
+    connect(notifier, SIGNAL(activated(int)), this, SLOT(onTriggerActivated()));
+
+    const int id = m_nextTrigger++;
+    m_triggers.insert(id, notifier);
+    return id;
+}
+
+void Pressure::removeTrigger(int id)
+{
+    QSocketNotifier *notifier = m_triggers.take(id);
+    if (!notifier) {
+        return;
+    }
+
+    const int fd = int(notifier->socket());
+    delete notifier;
+    QT_CLOSE(fd);
+}
+
+void Pressure::onTriggerActivated()
+{
+    QSocketNotifier *notifier = qobject_cast<QSocketNotifier *>(sender());
+    const int id = m_triggers.key(notifier, -1);
+    if (id >= 0) {
+        emit triggered(id, m_udi);
+    }
+}
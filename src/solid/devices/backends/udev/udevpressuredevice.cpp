@@ -0,0 +1,124 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "udevpressuredevice.h"
+
+#include "udev.h"
+#include "udevpressure.h"
+#include "../shared/pressurestall.h"
+
+#include <QtCore/QFile>
+
+using namespace Solid::Backends::UDev;
+
+static const char pressureDir[] = "/proc/pressure/";
+
+static QString pressureUdiPrefix()
+{
+    return QString::fromLatin1(UDEV_UDI_PREFIX) + QLatin1String("/pressure/");
+}
+
+PressureDevice::PressureDevice(const QString &udi)
+    : Solid::Ifaces::Device()
+    , m_udi(udi)
+    , m_name(udi.mid(pressureUdiPrefix().size()))
+{
+}
+
+PressureDevice::~PressureDevice()
+{
+}
+
+QString PressureDevice::udi() const
+{
+    return m_udi;
+}
+
+QString PressureDevice::parentUdi() const
+{
+    return QString::fromLatin1(UDEV_UDI_PREFIX);
+}
+
+QString PressureDevice::vendor() const
+{
+    return QStringLiteral("Linux");
+}
+
+QString PressureDevice::product() const
+{
+    switch (Shared::PressureStall::resourceFromName(m_name)) {
+    case Solid::Pressure::Cpu:
+        return tr("CPU Pressure");
+    case Solid::Pressure::Memory:
+        return tr("Memory Pressure");
+    case Solid::Pressure::Io:
+        return tr("I/O Pressure");
+    case Solid::Pressure::UnknownResource:
+        break;
+    }
+    return m_name;
+}
+
+QString PressureDevice::icon() const
+{
+    return QStringLiteral("utilities-system-monitor");
+}
+
+QStringList PressureDevice::emblems() const
+{
+    return QStringList();
+}
+
+QString PressureDevice::description() const
+{
+    return tr("Pressure Stall Information");
+}
+
+bool PressureDevice::queryDeviceInterface(const Solid::DeviceInterface::Type &type) const
+{
+    return type == Solid::DeviceInterface::Pressure;
+}
+
+QObject *PressureDevice::createDeviceInterface(const Solid::DeviceInterface::Type &type)
+{
+    if (type != Solid::DeviceInterface::Pressure) {
+        return nullptr;
+    }
+    return new Pressure(this);
+}
+
+QString PressureDevice::path() const
+{
+    return QLatin1String(pressureDir) + m_name;
+}
+
+QStringList PressureDevice::availableUdis()
+{
+    static const char *const resources[] = { "cpu", "memory", "io" };
+
+    QStringList udis;
+    for (size_t i = 0; i < sizeof(resources) / sizeof(resources[0]); ++i) {
+        const QString name = QLatin1String(resources[i]);
+        if (QFile::exists(QLatin1String(pressureDir) + name)) {
+            udis << pressureUdiPrefix() + name;
+        }
+    }
+    return udis;
+}
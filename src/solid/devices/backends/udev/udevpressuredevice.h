@@ -0,0 +1,78 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_UDEV_PRESSUREDEVICE_H
+#define SOLID_BACKENDS_UDEV_PRESSUREDEVICE_H
+
+#include <solid/devices/ifaces/device.h>
+
+#include <QtCore/QStringList>
+
+namespace Solid
+{
+namespace Backends
+{
+namespace UDev
+{
+
+/**
+ * The pressure stall information of a resource. It has no udev device, so
+ * the manager lists one of these for every file under /proc/pressure.
+ */
+class PressureDevice : public Solid::Ifaces::Device
+{
+    Q_OBJECT
+
+public:
+    explicit PressureDevice(const QString &udi);
+    virtual ~PressureDevice();
+
+    QString udi() const Q_DECL_OVERRIDE;
+    QString parentUdi() const Q_DECL_OVERRIDE;
+    QString vendor() const Q_DECL_OVERRIDE;
+    QString product() const Q_DECL_OVERRIDE;
+    QString icon() const Q_DECL_OVERRIDE;
+    QStringList emblems() const Q_DECL_OVERRIDE;
+    QString description() const Q_DECL_OVERRIDE;
+
+    bool queryDeviceInterface(const Solid::DeviceInterface::Type &type) const Q_DECL_OVERRIDE;
+    QObject *createDeviceInterface(const Solid::DeviceInterface::Type &type) Q_DECL_OVERRIDE;
+
+    /**
+     * @return the procfs file, e.g. /proc/pressure/io
+     */
+    QString path() const;
+
+    /**
+     * @return the UDIs of the resources the running kernel reports, none if
+     * it was built or booted without PSI
+     */
+    static QStringList availableUdis();
+
+private:
+    QString m_udi;
+    QString m_name;
+};
+
+}
+}
+}
+
+#endif // SOLID_BACKENDS_UDEV_PRESSUREDEVICE_H
@@ -24,21 +24,89 @@
 #include "cpuinfo.h"
 #include "../shared/cpufeatures.h"
 
+#include <QtCore/QDir>
 #include <QtCore/QFile>
 
 using namespace Solid::Backends::UDev;
 
+static QByteArray readSysfsValue(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    return file.readAll().trimmed();
+}
+
+static int readSysfsInt(const QString &path)
+{
+    bool ok;
+    const int value = readSysfsValue(path).toInt(&ok);
+    return ok ? value : -1;
+}
+
+// parses sizes such as "48K" or "32M" as found in cache/indexN/size
+static qulonglong parseCacheSize(const QByteArray &value)
+{
+    if (value.isEmpty()) {
+        return 0;
+    }
+
+    qulonglong multiplier = 1;
+    QByteArray digits = value;
+    switch (value.at(value.size() - 1)) {
+    case 'K':
+        multiplier = Q_UINT64_C(1) << 10;
+        break;
+    case 'M':
+        multiplier = Q_UINT64_C(1) << 20;
+        break;
+    case 'G':
+        multiplier = Q_UINT64_C(1) << 30;
+        break;
+    default:
+        break;
+    }
+    if (multiplier != 1) {
+        digits.chop(1);
+    }
+    return digits.toULongLong() * multiplier;
+}
+
+// the position of @p cpu in a cpu list such as "0-3,8-11", or -1
+static int indexInCpuList(const QByteArray &list, int cpu)
+{
+    int index = 0;
+    Q_FOREACH (const QByteArray &range, list.split(',')) {
+        const int dash = range.indexOf('-');
+        const int first = (dash < 0 ? range : range.left(dash)).toInt();
+        const int last = dash < 0 ? first : range.mid(dash + 1).toInt();
+        if (cpu >= first && cpu <= last) {
+            return index + cpu - first;
+        }
+        index += last - first + 1;
+    }
+    return -1;
+}
+
 Processor::Processor(UDevDevice *device)
     : DeviceInterface(device),
       m_canChangeFrequency(NotChecked),
-      m_maxSpeed(-1)
+      m_maxSpeed(-1),
+      m_topologyLoaded(false),
+      m_packageId(-1),
+      m_dieId(-1),
+      m_coreId(-1),
+      m_threadId(-1),
+      m_numaNode(-1),
+      m_telemetryOpened(false)
 {
 
 }
 
 Processor::~Processor()
 {
-
+    qDeleteAll(m_idleStates);
 }
 
 int Processor::number() const
@@ -61,7 +129,7 @@ int Processor::maxSpeed() const
         }
         if (m_maxSpeed <= 0) {
             // couldn't get the info from /sys, try /proc instead
-            m_maxSpeed = extractCurrentCpuSpeed(number());
+            m_maxSpeed = CpuInfo::instance()->currentSpeed(number());
         }
     }
     return m_maxSpeed;
@@ -106,3 +174,218 @@ QString Processor::prefix() const
     return QString();
 }
 
+int Processor::packageId() const
+{
+    loadTopology();
+    return m_packageId;
+}
+
+int Processor::dieId() const
+{
+    loadTopology();
+    return m_dieId;
+}
+
+int Processor::coreId() const
+{
+    loadTopology();
+    return m_coreId;
+}
+
+int Processor::threadId() const
+{
+    loadTopology();
+    return m_threadId;
+}
+
+int Processor::numaNode() const
+{
+    loadTopology();
+    return m_numaNode;
+}
+
+QString Processor::threadSiblings() const
+{
+    loadTopology();
+    return m_threadSiblings;
+}
+
+QString Processor::packageSiblings() const
+{
+    loadTopology();
+    return m_packageSiblings;
+}
+
+Solid::Processor::CacheList Processor::caches() const
+{
+    loadTopology();
+    return m_caches;
+}
+
+void Processor::loadTopology() const
+{
+    if (m_topologyLoaded) {
+        return;
+    }
+    m_topologyLoaded = true;
+
+    const QString cpuPath = m_device->deviceName() + prefix();
+    const QString topology = cpuPath + QLatin1String("/topology/");
+
+    m_packageId = readSysfsInt(topology + QLatin1String("physical_package_id"));
+    m_dieId = readSysfsInt(topology + QLatin1String("die_id"));
+    m_coreId = readSysfsInt(topology + QLatin1String("core_id"));
+
+    // core_cpus_list and package_cpus_list replace the older names since Linux 5.3
+    QByteArray siblings = readSysfsValue(topology + QLatin1String("core_cpus_list"));
+    if (siblings.isEmpty()) {
+        siblings = readSysfsValue(topology + QLatin1String("thread_siblings_list"));
+    }
+    m_threadSiblings = QString::fromLatin1(siblings);
+    if (!siblings.isEmpty()) {
+        m_threadId = indexInCpuList(siblings, number());
+    }
+
+    siblings = readSysfsValue(topology + QLatin1String("package_cpus_list"));
+    if (siblings.isEmpty()) {
+        siblings = readSysfsValue(topology + QLatin1String("core_siblings_list"));
+    }
+    m_packageSiblings = QString::fromLatin1(siblings);
+
+    // the cpu directory links to its NUMA node as "nodeN"
+    const QStringList nodes = QDir(cpuPath).entryList(QStringList() << QStringLiteral("node*"), QDir::Dirs | QDir::NoDotAndDotDot);
+    Q_FOREACH (const QString &node, nodes) {
+        bool ok;
+        const int nodeNumber = node.mid(4).toInt(&ok);
+        if (ok) {
+            m_numaNode = nodeNumber;
+            break;
+        }
+    }
+
+    const QDir cacheDir(cpuPath + QLatin1String("/cache"));
+    const QStringList indexes = cacheDir.entryList(QStringList() << QStringLiteral("index*"), QDir::Dirs | QDir::NoDotAndDotDot);
+    Q_FOREACH (const QString &index, indexes) {
+        const QString path = cacheDir.filePath(index) + QLatin1Char('/');
+
+        Solid::Processor::Cache cache;
+        cache.level = readSysfsInt(path + QLatin1String("level"));
+        if (cache.level <= 0) {
+            continue;
+        }
+        const QByteArray type = readSysfsValue(path + QLatin1String("type"));
+        if (type == "Data") {
+            cache.type = Solid::Processor::DataCache;
+        } else if (type == "Instruction") {
+            cache.type = Solid::Processor::InstructionCache;
+        } else {
+            cache.type = Solid::Processor::UnifiedCache;
+        }
+        cache.size = parseCacheSize(readSysfsValue(path + QLatin1String("size")));
+        cache.lineSize = qMax(0, readSysfsInt(path + QLatin1String("coherency_line_size")));
+        cache.ways = qMax(0, readSysfsInt(path + QLatin1String("ways_of_associativity")));
+        cache.sharedCpus = QString::fromLatin1(readSysfsValue(path + QLatin1String("shared_cpu_list")));
+
+        // keep the list ordered by level, data before instruction caches
+        int pos = 0;
+        while (pos < m_caches.size() && (m_caches.at(pos).level < cache.level ||
+                (m_caches.at(pos).level == cache.level && m_caches.at(pos).type <= cache.type))) {
+            ++pos;
+        }
+        m_caches.insert(pos, cache);
+    }
+}
+
+void Processor::openTelemetry() const
+{
+    if (m_telemetryOpened) {
+        return;
+    }
+    m_telemetryOpened = true;
+
+    const QString cpuPath = m_device->deviceName() + prefix();
+    m_curFreq.setPath(cpuPath + QLatin1String("/cpufreq/scaling_cur_freq"));
+    m_governor.setPath(cpuPath + QLatin1String("/cpufreq/scaling_governor"));
+    m_epp.setPath(cpuPath + QLatin1String("/cpufreq/energy_performance_preference"));
+    // only provided by x86 processors with thermal monitoring
+    m_coreThrottle.setPath(cpuPath + QLatin1String("/thermal_throttle/core_throttle_count"));
+    m_packageThrottle.setPath(cpuPath + QLatin1String("/thermal_throttle/package_throttle_count"));
+
+    // stateN directories are numbered from the shallowest state on
+    const QString idlePath = cpuPath + QLatin1String("/cpuidle/state%1/");
+    for (int i = 0; ; ++i) {
+        const QString statePath = idlePath.arg(i);
+        const QByteArray name = readSysfsValue(statePath + QLatin1String("name"));
+        if (name.isEmpty()) {
+            break;
+        }
+
+        IdleStateFiles *state = new IdleStateFiles;
+        state->description.name = QString::fromLatin1(name);
+        state->description.exitLatency = qMax(0, readSysfsInt(statePath + QLatin1String("latency")));
+        state->description.targetResidency = qMax(0, readSysfsInt(statePath + QLatin1String("residency")));
+        state->time.setPath(statePath + QLatin1String("time"));
+        state->usage.setPath(statePath + QLatin1String("usage"));
+        state->disable.setPath(statePath + QLatin1String("disable"));
+        m_idleStates << state;
+    }
+}
+
+int Processor::currentSpeed() const
+{
+    openTelemetry();
+
+    bool ok;
+    const qlonglong freq = m_curFreq.readLongLong(&ok);
+    if (ok && freq > 0) {
+        // scaling_cur_freq is in kHz
+        return static_cast<int>(freq / 1000);
+    }
+    return CpuInfo::instance()->currentSpeed(number());
+}
+
+QString Processor::governor() const
+{
+    openTelemetry();
+    return QString::fromLatin1(m_governor.read());
+}
+
+QString Processor::energyPerformancePreference() const
+{
+    openTelemetry();
+    return QString::fromLatin1(m_epp.read());
+}
+
+Solid::Processor::IdleStateList Processor::idleStates() const
+{
+    openTelemetry();
+
+    Solid::Processor::IdleStateList result;
+    Q_FOREACH (IdleStateFiles *files, m_idleStates) {
+        Solid::Processor::IdleState state = files->description;
+        state.time = files->time.readULongLong();
+        state.usage = files->usage.readULongLong();
+        state.disabled = files->disable.readLongLong() != 0;
+        result << state;
+    }
+    return result;
+}
+
+qlonglong Processor::coreThrottleCount() const
+{
+    openTelemetry();
+
+    bool ok;
+    const qlonglong count = m_coreThrottle.readLongLong(&ok);
+    return ok ? count : -1;
+}
+
+qlonglong Processor::packageThrottleCount() const
+{
+    openTelemetry();
+
+    bool ok;
+    const qlonglong count = m_packageThrottle.readLongLong(&ok);
+    return ok ? count : -1;
+}
+
@@ -23,6 +23,7 @@
 
 #include <solid/devices/ifaces/processor.h>
 #include "udevdeviceinterface.h"
+#include "../shared/sysfsfile.h"
 
 namespace Solid
 {
@@ -45,6 +46,20 @@ public:
     int maxSpeed() const Q_DECL_OVERRIDE;
     bool canChangeFrequency() const Q_DECL_OVERRIDE;
     Solid::Processor::InstructionSets instructionSets() const Q_DECL_OVERRIDE;
+    int packageId() const Q_DECL_OVERRIDE;
+    int dieId() const Q_DECL_OVERRIDE;
+    int coreId() const Q_DECL_OVERRIDE;
+    int threadId() const Q_DECL_OVERRIDE;
+    int numaNode() const Q_DECL_OVERRIDE;
+    QString threadSiblings() const Q_DECL_OVERRIDE;
+    QString packageSiblings() const Q_DECL_OVERRIDE;
+    Solid::Processor::CacheList caches() const Q_DECL_OVERRIDE;
+    int currentSpeed() const Q_DECL_OVERRIDE;
+    QString governor() const Q_DECL_OVERRIDE;
+    QString energyPerformancePreference() const Q_DECL_OVERRIDE;
+    Solid::Processor::IdleStateList idleStates() const Q_DECL_OVERRIDE;
+    qlonglong coreThrottleCount() const Q_DECL_OVERRIDE;
+    qlonglong packageThrottleCount() const Q_DECL_OVERRIDE;
 
 private:
     enum CanChangeFrequencyEnum {
@@ -55,6 +70,34 @@ private:
     mutable CanChangeFrequencyEnum m_canChangeFrequency;
     mutable int m_maxSpeed;
     QString prefix() const;
+
+    // topology and caches don't change while the processor is online
+    void loadTopology() const;
+    mutable bool m_topologyLoaded;
+    mutable int m_packageId;
+    mutable int m_dieId;
+    mutable int m_coreId;
+    mutable int m_threadId;
+    mutable int m_numaNode;
+    mutable QString m_threadSiblings;
+    mutable QString m_packageSiblings;
+    mutable Solid::Processor::CacheList m_caches;
+
+    // live attributes, kept open between reads
+    struct IdleStateFiles {
+        Solid::Processor::IdleState description;
+        Shared::SysfsFile time;
+        Shared::SysfsFile usage;
+        Shared::SysfsFile disable;
+    };
+    void openTelemetry() const;
+    mutable bool m_telemetryOpened;
+    mutable Shared::SysfsFile m_curFreq;
+    mutable Shared::SysfsFile m_governor;
+    mutable Shared::SysfsFile m_epp;
+    mutable Shared::SysfsFile m_coreThrottle;
+    mutable Shared::SysfsFile m_packageThrottle;
+    mutable QList<IdleStateFiles *> m_idleStates;
 };
 }
 }
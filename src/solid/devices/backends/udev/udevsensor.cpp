@@ -0,0 +1,173 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "udevsensor.h"
+#include "udevdevice.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QMap>
+
+using namespace Solid::Backends::UDev;
+
+namespace
+{
+struct ChannelType {
+    const char *prefix;
+    Solid::Sensor::ReadingType type;
+    double scale;
+};
+
+// see Documentation/hwmon/sysfs-interface in the kernel sources
+const ChannelType channelTypes[] = {
+    { "temp", Solid::Sensor::Temperature, 1000 },
+    { "fan", Solid::Sensor::Fan, 1 },
+    { "in", Solid::Sensor::Voltage, 1000 },
+    { "curr", Solid::Sensor::Current, 1000 },
+    { "power", Solid::Sensor::Power, 1000000 },
+    { "energy", Solid::Sensor::Energy, 1000000 },
+    { "humidity", Solid::Sensor::Humidity, 1000 }
+};
+
+QByteArray readOnce(const QString &path)
+{
+    Solid::Backends::Shared::SysfsFile file(path);
+    return file.read();
+}
+}
+
+Sensor::Sensor(UDevDevice *device)
+    : DeviceInterface(device)
+    , m_scanned(false)
+{
+}
+
+Sensor::~Sensor()
+{
+    qDeleteAll(m_channels);
+}
+
+bool Sensor::isThermalZone() const
+{
+    return m_device->udevDevice().subsystem() == QLatin1String("thermal");
+}
+
+QString Sensor::name() const
+{
+    scan();
+    return m_name;
+}
+
+void Sensor::scan() const
+{
+    if (m_scanned) {
+        return;
+    }
+    m_scanned = true;
+
+    const QString path = m_device->deviceName();
+    m_name = QString::fromLatin1(readOnce(path + (isThermalZone() ? QLatin1String("/type") : QLatin1String("/name"))));
+    if (isThermalZone()) {
+        scanThermalZone(path);
+        return;
+    }
+
+    scanHwmon(path);
+    if (m_channels.isEmpty()) {
+        // older drivers put the attributes on the parent device
+        scanHwmon(path + QLatin1String("/device"));
+    }
+}
+
+void Sensor::scanHwmon(const QString &path) const
+{
+    const QDir dir(path);
+    for (size_t i = 0; i < sizeof(channelTypes) / sizeof(channelTypes[0]); ++i) {
+        const ChannelType &channelType = channelTypes[i];
+        const QString prefix = QLatin1String(channelType.prefix);
+
+        // order the channels by number rather than by name, temp10 comes after temp9
+        QMap<int, QString> inputs;
+        Q_FOREACH (const QString &entry, dir.entryList(QStringList() << prefix + QLatin1String("*_input"), QDir::Files)) {
+            bool ok;
+            const int number = entry.midRef(prefix.size(), entry.size() - prefix.size() - 6).toInt(&ok);
+            if (ok) {
+                inputs.insert(number, entry.left(entry.size() - 6));
+            }
+        }
+
+        for (QMap<int, QString>::const_iterator it = inputs.constBegin(); it != inputs.constEnd(); ++it) {
+            const QString base = path + QLatin1Char('/') + it.value();
+
+            Channel *channel = new Channel;
+            channel->scale = channelType.scale;
+            channel->input.setPath(base + QLatin1String("_input"));
+            channel->reading.type = channelType.type;
+            channel->reading.label = QString::fromLatin1(readOnce(base + QLatin1String("_label")));
+            if (channel->reading.label.isEmpty()) {
+                channel->reading.label = it.value();
+            }
+            channel->reading.maximum = readOnce(base + QLatin1String("_max")).toLongLong() / channel->scale;
+            channel->reading.critical = readOnce(base + QLatin1String("_crit")).toLongLong() / channel->scale;
+            m_channels << channel;
+        }
+    }
+}
+
+void Sensor::scanThermalZone(const QString &path) const
+{
+    Channel *channel = new Channel;
+    channel->scale = 1000;
+    channel->input.setPath(path + QLatin1String("/temp"));
+    channel->reading.type = Solid::Sensor::Temperature;
+    channel->reading.label = m_device->udevDevice().name();
+
+    const QDir dir(path);
+    Q_FOREACH (const QString &entry, dir.entryList(QStringList() << QStringLiteral("trip_point_*_type"), QDir::Files)) {
+        const QByteArray type = readOnce(path + QLatin1Char('/') + entry);
+        const QString temperature = path + QLatin1Char('/') + entry.left(entry.size() - 4) + QLatin1String("temp");
+        if (type == "critical") {
+            channel->reading.critical = readOnce(temperature).toLongLong() / channel->scale;
+        } else if (type == "hot") {
+            channel->reading.maximum = readOnce(temperature).toLongLong() / channel->scale;
+        }
+    }
+    m_channels << channel;
+}
+
+Solid::Sensor::ReadingList Sensor::readings() const
+{
+    scan();
+
+    Solid::Sensor::ReadingList readings;
+    readings.reserve(m_channels.size());
+    Q_FOREACH (Channel *channel, m_channels) {
+        bool ok;
+        const qlonglong value = channel->input.readLongLong(&ok);
+        if (!ok) {
+            // e.g. a fan that isn't connected, or a zone that is switched off
+            continue;
+        }
+
+        Solid::Sensor::Reading reading = channel->reading;
+        reading.value = value / channel->scale;
+        readings << reading;
+    }
+    return readings;
+}
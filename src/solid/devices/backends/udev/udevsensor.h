@@ -0,0 +1,72 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BACKENDS_UDEV_SENSOR_H
+#define SOLID_BACKENDS_UDEV_SENSOR_H
+
+#include <solid/devices/ifaces/sensor.h>
+#include "udevdeviceinterface.h"
+#include "../shared/sysfsfile.h"
+
+#include <QtCore/QVector>
+
+namespace Solid
+{
+namespace Backends
+{
+namespace UDev
+{
+class UDevDevice;
+
+class Sensor : public DeviceInterface, virtual public Solid::Ifaces::Sensor
+{
+    Q_OBJECT
+    Q_INTERFACES(Solid::Ifaces::Sensor)
+
+public:
+    Sensor(UDevDevice *device);
+    virtual ~Sensor();
+
+    QString name() const Q_DECL_OVERRIDE;
+    Solid::Sensor::ReadingList readings() const Q_DECL_OVERRIDE;
+
+private:
+    struct Channel {
+        Solid::Sensor::Reading reading;
+        // raw values are in milli- or micro-units
+        double scale;
+        Shared::SysfsFile input;
+    };
+
+    bool isThermalZone() const;
+    void scan() const;
+    void scanHwmon(const QString &path) const;
+    void scanThermalZone(const QString &path) const;
+
+    mutable bool m_scanned;
+    // the name, labels and limits are read once, only the values are read live
+    mutable QString m_name;
+    mutable QVector<Channel *> m_channels;
+};
+}
+}
+}
+
+#endif // SOLID_BACKENDS_UDEV_SENSOR_H
@@ -34,11 +34,18 @@
 #include <QtXml/QDomDocument>
 
 #include "udisksblock.h"
+#include "config-solid.h"
+#if UDEV_FOUND
+#include "../shared/blockqueue.h"
+#include "../shared/blockstatistics.h"
+#endif
 
 using namespace Solid::Backends::UDisks2;
 
 Block::Block(Device *dev)
     : DeviceInterface(dev)
+    , m_statistics(nullptr)
+    , m_queue(nullptr)
 {
     m_devNum = m_device->prop("DeviceNumber").toULongLong();
     m_devFile = QFile::decodeName(m_device->prop("Device").toByteArray());
@@ -78,6 +85,10 @@ Block::Block(Device *dev)
 
 Block::~Block()
 {
+#if UDEV_FOUND
+    delete m_statistics;
+    delete m_queue;
+#endif
 }
 
 QString Block::device() const
@@ -94,3 +105,145 @@ int Block::deviceMajor() const
 {
     return MAJOR(m_devNum);
 }
+
+Solid::Block::IoStatistics Block::ioStatistics() const
+{
+#if UDEV_FOUND
+    if (!m_statistics) {
+        if (m_devNum == 0) {
+            return Solid::Block::IoStatistics();
+        }
+        m_statistics = new Shared::BlockStatistics(deviceMajor(), deviceMinor());
+    }
+    return m_statistics->read();
+#else
+    return Solid::Block::IoStatistics();
+#endif
+}
+
+// UDisks2 has none of the queue attributes, read them from sysfs like the
+// udev backend does
+const Solid::Backends::Shared::BlockQueue *Block::queue() const
+{
+#if UDEV_FOUND
+    if (!m_queue && m_devNum != 0) {
+        m_queue = new Shared::BlockQueue(deviceMajor(), deviceMinor());
+    }
+    return m_queue;
+#else
+    return nullptr;
+#endif
+}
+
+bool Block::isRotational() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->isRotational();
+    }
+#endif
+    // the rotation rate belongs to the Drive object the block links to:
+    // -1 if unknown, 0 for solid state
+    const DeviceBackend::Ptr drive = m_device->driveBackend();
+    return drive && drive->prop("RotationRate").toInt() > 0;
+}
+
+int Block::logicalBlockSize() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->logicalBlockSize();
+    }
+#endif
+    return 0;
+}
+
+int Block::physicalBlockSize() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->physicalBlockSize();
+    }
+#endif
+    return 0;
+}
+
+int Block::minimumIoSize() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->minimumIoSize();
+    }
+#endif
+    return 0;
+}
+
+int Block::optimalIoSize() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->optimalIoSize();
+    }
+#endif
+    return 0;
+}
+
+int Block::discardGranularity() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->discardGranularity();
+    }
+#endif
+    return 0;
+}
+
+Solid::Block::ZonedModel Block::zonedModel() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->zonedModel();
+    }
+#endif
+    return Solid::Block::NotZoned;
+}
+
+QString Block::scheduler() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->scheduler();
+    }
+#endif
+    return QString();
+}
+
+int Block::requestQueueSize() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->requestQueueSize();
+    }
+#endif
+    return 0;
+}
+
+int Block::readAheadSize() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->readAheadSize();
+    }
+#endif
+    return 0;
+}
+
+int Block::hardwareQueueCount() const
+{
+#if UDEV_FOUND
+    if (queue()) {
+        return queue()->hardwareQueueCount();
+    }
+#endif
+    return 0;
+}
@@ -30,6 +30,12 @@ namespace Solid
 {
 namespace Backends
 {
+namespace Shared
+{
+class BlockQueue;
+class BlockStatistics;
+}
+
 namespace UDisks2
 {
 
@@ -46,9 +52,25 @@ public:
     QString device() const Q_DECL_OVERRIDE;
     int deviceMinor() const Q_DECL_OVERRIDE;
     int deviceMajor() const Q_DECL_OVERRIDE;
+    Solid::Block::IoStatistics ioStatistics() const Q_DECL_OVERRIDE;
+    bool isRotational() const Q_DECL_OVERRIDE;
+    int logicalBlockSize() const Q_DECL_OVERRIDE;
+    int physicalBlockSize() const Q_DECL_OVERRIDE;
+    int minimumIoSize() const Q_DECL_OVERRIDE;
+    int optimalIoSize() const Q_DECL_OVERRIDE;
+    int discardGranularity() const Q_DECL_OVERRIDE;
+    Solid::Block::ZonedModel zonedModel() const Q_DECL_OVERRIDE;
+    QString scheduler() const Q_DECL_OVERRIDE;
+    int requestQueueSize() const Q_DECL_OVERRIDE;
+    int readAheadSize() const Q_DECL_OVERRIDE;
+    int hardwareQueueCount() const Q_DECL_OVERRIDE;
 private:
+    const Shared::BlockQueue *queue() const;
+
     dev_t m_devNum;
     QString m_devFile;
+    mutable Shared::BlockStatistics *m_statistics;
+    mutable Shared::BlockQueue *m_queue;
 };
 
 }
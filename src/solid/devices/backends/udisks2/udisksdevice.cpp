@@ -91,8 +91,8 @@ Device::Device(const QString &udi)
     , m_backend(DeviceBackend::backendForUDI(udi))
 {
     if (m_backend) {
-        connect(m_backend, SIGNAL(changed()), this, SIGNAL(changed()));
-        connect(m_backend, SIGNAL(propertyChanged(QMap<QString,int>)), this, SIGNAL(propertyChanged(QMap<QString,int>)));
+        connect(m_backend.data(), SIGNAL(changed()), this, SIGNAL(changed()));
+        connect(m_backend.data(), SIGNAL(propertyChanged(QMap<QString,int>)), this, SIGNAL(propertyChanged(QMap<QString,int>)));
     } else {
         qDebug() << "Created invalid Device for udi" << udi;
     }
@@ -244,6 +244,32 @@ QString Device::description() const
         return hintName;
     }
 
+    return memoised(DeviceBackend::DescriptionField);
+}
+
+QString Device::memoised(DeviceBackend::PresentationField field) const
+{
+    if (!m_backend) {
+        return field == DeviceBackend::DescriptionField ? computeDescription() : computeIcon();
+    }
+
+    // the stamp is taken first, so that a change during the computation is not lost
+    const DeviceBackend::Ptr drive = driveBackend();
+    const quint64 stamp = (quint64(m_backend->presentationGeneration()) << 32)
+                          | (drive ? drive->presentationGeneration() : 0);
+
+    QString value;
+    if (m_backend->cachedPresentation(field, stamp, &value)) {
+        return value;
+    }
+
+    value = field == DeviceBackend::DescriptionField ? computeDescription() : computeIcon();
+    m_backend->storePresentation(field, stamp, value);
+    return value;
+}
+
+QString Device::computeDescription() const
+{
     if (isLoop()) {
         return tr("Loop Device");
     } else if (isSwap()) {
@@ -411,9 +437,16 @@ QString Device::volumeDescription() const
         return volume_label;
     }
 
-    UDisks2::Device storageDevice(drivePath());
-    const UDisks2::StorageDrive storageDrive(&storageDevice);
-    Solid::StorageDrive::DriveType drive_type = storageDrive.driveType();
+    // without a drive (loop devices and the like) describe it like a fixed hard disk
+    Solid::StorageDrive::DriveType drive_type = Solid::StorageDrive::HardDisk;
+    bool drive_is_removable = false;
+    bool drive_is_hotpluggable = false;
+    if (Device *storageDevice = driveDevice()) {
+        const UDisks2::StorageDrive storageDrive(storageDevice);
+        drive_type = storageDrive.driveType();
+        drive_is_removable = storageDrive.isRemovable();
+        drive_is_hotpluggable = storageDrive.isHotpluggable();
+    }
 
     // Handle media in optical drives
     if (drive_type == Solid::StorageDrive::CdromDrive) {
@@ -549,9 +582,6 @@ QString Device::volumeDescription() const
         return description;
     }
 
-    const bool drive_is_removable = storageDrive.isRemovable();
-    const bool drive_is_hotpluggable = storageDrive.isHotpluggable();
-
     QString size_str = formatByteSize(storageVolume.size());
     if (isEncryptedContainer()) {
         if (!size_str.isEmpty()) {
@@ -592,7 +622,14 @@ QString Device::icon() const
 
     if (!iconName.isEmpty()) {
         return iconName;
-    } else if (isLoop() || isSwap()) {
+    }
+
+    return memoised(DeviceBackend::IconField);
+}
+
+QString Device::computeIcon() const
+{
+    if (isLoop() || isSwap()) {
         return "drive-harddisk";
     } else if (isDrive()) {
         const bool isRemovable = prop("Removable").toBool();
@@ -608,19 +645,17 @@ QString Device::icon() const
             }
         }
     } else if (isBlock()) {
-        const QString drv = drivePath();
-        if (drv.isEmpty() || drv == "/") {
+        const DeviceBackend::Ptr drive = driveBackend();
+        if (!drive) {
             return "drive-harddisk";    // stuff like loop devices or swap which don't have the Drive prop set
         }
 
-        Device drive(drv);
-
         // handle media
-        const QString media = drive.prop("Media").toString();
+        const QString media = drive->prop("Media").toString();
 
         if (!media.isEmpty()) {
-            if (drive.prop("Optical").toBool()) {    // optical stuff
-                bool isWritable = drive.prop("OpticalBlank").toBool();
+            if (drive->prop("Optical").toBool()) {    // optical stuff
+                bool isWritable = drive->prop("OpticalBlank").toBool();
 
                 const UDisks2::OpticalDisc disc(const_cast<Device *>(this));
                 Solid::OpticalDisc::ContentTypes availContent = disc.availableContent();
@@ -664,11 +699,11 @@ QString Device::icon() const
             }
         }
 
-        if (drive.prop("ConnectionBus").toString() == "sdio") { // hack for SD cards connected thru sdio bus
+        if (drive->prop("ConnectionBus").toString() == "sdio") { // hack for SD cards connected thru sdio bus
             return "media-flash-sd-mmc";
         }
 
-        return drive.icon();
+        return driveDevice()->icon();
     }
 
     return "drive-harddisk";    // general fallback
@@ -677,8 +712,8 @@ QString Device::icon() const
 QString Device::product() const
 {
     if (!isDrive()) {
-        Device drive(drivePath());
-        return drive.prop("Model").toString();
+        const DeviceBackend::Ptr drive = driveBackend();
+        return drive ? drive->prop("Model").toString() : QString();
     }
 
     return prop("Model").toString();
@@ -687,8 +722,8 @@ QString Device::product() const
 QString Device::vendor() const
 {
     if (!isDrive()) {
-        Device drive(drivePath());
-        return drive.prop("Vendor").toString();
+        const DeviceBackend::Ptr drive = driveBackend();
+        return drive ? drive->prop("Vendor").toString() : QString();
     }
 
     return prop("Vendor").toString();
@@ -699,9 +734,9 @@ QString Device::parentUdi() const
     QString parent;
 
     if (propertyExists("Drive")) { // block
-        parent = drivePath();
+        parent = m_backend->linkPath(DeviceBackend::DriveLink);
     } else if (propertyExists("Table")) { // partition
-        parent = prop("Table").value<QDBusObjectPath>().path();
+        parent = m_backend->linkPath(DeviceBackend::TableLink);
     } else if (parent.isEmpty() || parent == "/") {
         parent = UD2_UDI_DISKS_PREFIX;
     }
@@ -795,24 +830,15 @@ bool Device::isOpticalDrive() const
 
 bool Device::isOpticalDisc() const
 {
-    const QString drv = drivePath();
-    if (drv.isEmpty() || drv == "/") {
-        return false;
-    }
-
-    Device drive(drv);
-    return drive.prop("Optical").toBool();
+    const DeviceBackend::Ptr drive = driveBackend();
+    return drive && drive->prop("Optical").toBool();
 }
 
 bool Device::mightBeOpticalDisc() const
 {
-    const QString drv = drivePath();
-    if (drv.isEmpty() || drv == "/") {
-        return false;
-    }
-
-    Device drive(drv);
-    return drive.isOpticalDrive();
+    const DeviceBackend::Ptr drive = driveBackend();
+    return drive && drive->interfaces().contains(UD2_DBUS_INTERFACE_DRIVE)
+           && !drive->prop("MediaCompatibility").toStringList().filter("optical_").isEmpty();
 }
 
 bool Device::isMounted() const
@@ -849,3 +875,30 @@ QString Device::drivePath() const
 {
     return prop("Drive").value<QDBusObjectPath>().path();
 }
+
+QString Device::cleartextPath() const
+{
+    return m_backend ? m_backend->linkPath(DeviceBackend::CleartextLink) : QString();
+}
+
+DeviceBackend::Ptr Device::driveBackend() const
+{
+    return m_backend ? m_backend->link(DeviceBackend::DriveLink) : DeviceBackend::Ptr();
+}
+
+Device *Device::driveDevice() const
+{
+    const DeviceBackend::Ptr drive = driveBackend();
+    if (!drive) {
+        return nullptr;
+    }
+
+    // the wrapper is rebuilt only when the drive link changed
+    if (!m_driveDevice || m_driveDevice->udi() != drive->udi()) {
+        delete m_driveDevice.data();
+        m_driveDevice = new Device(drive->udi());
+        m_driveDevice->setParent(const_cast<Device *>(this));
+    }
+
+    return m_driveDevice.data();
+}
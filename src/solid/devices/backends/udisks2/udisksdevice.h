@@ -23,6 +23,7 @@
 #define UDISKS2DEVICE_H
 
 #include "udisks2.h"
+#include "udisksdevicebackend.h"
 
 #include <ifaces/device.h>
 #include <solid/deviceinterface.h>
@@ -30,6 +31,7 @@
 
 #include <QtDBus/QDBusInterface>
 #include <QtDBus/QDBusObjectPath>
+#include <QtCore/QPointer>
 #include <QtCore/QStringList>
 
 namespace Solid
@@ -39,8 +41,6 @@ namespace Backends
 namespace UDisks2
 {
 
-class DeviceBackend;
-
 class Device: public Solid::Ifaces::Device
 {
     Q_OBJECT
@@ -84,17 +84,25 @@ public:
     bool isLoop() const;
 
     QString drivePath() const;
+    QString cleartextPath() const;
+    DeviceBackend::Ptr driveBackend() const;
 
 Q_SIGNALS:
     void changed();
     void propertyChanged(const QMap<QString, int> &changes);
 
 protected:
-    QPointer<DeviceBackend> m_backend;
+    DeviceBackend::Ptr m_backend;
 
 private:
+    QString memoised(DeviceBackend::PresentationField field) const;
+    QString computeDescription() const;
+    QString computeIcon() const;
     QString storageDescription() const;
     QString volumeDescription() const;
+    Device *driveDevice() const;
+
+    mutable QPointer<Device> m_driveDevice;
 };
 
 }
@@ -22,6 +22,11 @@
 
 #include "udisksdevicebackend.h"
 
+#include <QtCore/QCoreApplication>
+#include <QtCore/QHash>
+#include <QtCore/QMap>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QThread>
 #include <QtDBus/QDBusConnection>
 #include <QtDBus/QDBusInterface>
 #include <QtXml/QDomDocument>
@@ -31,37 +36,259 @@
 
 using namespace Solid::Backends::UDisks2;
 
-/* Static cache for DeviceBackends for all UDIs */
-QMap<QString /* UDI */, DeviceBackend *> DeviceBackend::s_backends;
+namespace Solid
+{
+namespace Backends
+{
+namespace UDisks2
+{
+
+/* Process-wide cache of DeviceBackends for all UDIs, shared by the managers of all threads.
+ * The UDIs are spread over independently locked shards so that lookups from different
+ * threads rarely contend. */
+class BackendRegistry
+{
+public:
+    BackendRegistry()
+        : limit(qMax(0, qgetenv("SOLID_UDISKS2_CACHE_LIMIT").toInt()))
+    {
+    }
+
+    struct Shard {
+        QReadWriteLock lock;
+        QHash<QString /* UDI */, DeviceBackend::Ptr> backends;
+    };
+
+    Shard &shardFor(const QString &udi)
+    {
+        return shards[qHash(udi) % ShardCount];
+    }
+
+    void trim(const DeviceBackend *keep);
+    DeviceBackend::CacheStatistics statistics();
+
+    enum { ShardCount = 16 };
+    Shard shards[ShardCount];
+    const int limit;
+    QAtomicInteger<quint32> clock;
+    QAtomicInt cachedBackends;
+    QAtomicInt evictions;
+    QAtomicInt presentationRecomputations;
+};
+
+}
+}
+}
+
+Q_GLOBAL_STATIC(BackendRegistry, s_registry)
+
+static qint64 approximateSize(const QVariant &value)
+{
+    switch (value.type()) {
+    case QVariant::String:
+        return value.toString().size() * sizeof(QChar);
+    case QVariant::ByteArray:
+        return value.toByteArray().size();
+    case QVariant::StringList: {
+        qint64 size = 0;
+        Q_FOREACH (const QString &str, value.toStringList()) {
+            size += sizeof(QString) + str.size() * sizeof(QChar);
+        }
+        return size;
+    }
+    default:
+        return 0;
+    }
+}
+
+void BackendRegistry::trim(const DeviceBackend *keep)
+{
+    if (limit <= 0 || cachedBackends.load() <= limit) {
+        return;
+    }
+
+    for (int i = 0; i < ShardCount; ++i) {
+        shards[i].lock.lockForRead();
+    }
+
+    // oldest access first; the clock is compared relative to "now" so that it may wrap
+    const quint32 now = clock.load();
+    QMultiMap<quint32, DeviceBackend *> byAge;
+    for (int i = 0; i < ShardCount; ++i) {
+        Q_FOREACH (const DeviceBackend::Ptr &backend, shards[i].backends) {
+            if (backend.data() != keep) {
+                byAge.insert(now - backend->lastAccess(), backend.data());
+            }
+        }
+    }
+
+    QMapIterator<quint32, DeviceBackend *> it(byAge);
+    it.toBack();
+    while (cachedBackends.load() > limit && it.hasPrevious()) {
+        DeviceBackend *backend = it.previous().value();
+        QMutexLocker locker(&backend->m_cacheLock);
+        if (backend->hasCachedData()) {
+            backend->m_interfaceCaches.clear();
+            backend->m_propertyInterface.clear();
+            backend->m_missingProperties.clear();
+            cachedBackends.deref();
+            evictions.ref();
+        }
+    }
 
-DeviceBackend *DeviceBackend::backendForUDI(const QString &udi, bool create)
+    for (int i = ShardCount - 1; i >= 0; --i) {
+        shards[i].lock.unlock();
+    }
+}
+
+DeviceBackend::CacheStatistics BackendRegistry::statistics()
 {
-    DeviceBackend *backend = nullptr;
+    DeviceBackend::CacheStatistics stats = { 0, 0, 0, 0, evictions.load(), presentationRecomputations.load() };
+
+    for (int i = 0; i < ShardCount; ++i) {
+        QReadLocker shardLocker(&shards[i].lock);
+        Q_FOREACH (const DeviceBackend::Ptr &backend, shards[i].backends) {
+            ++stats.backends;
+            stats.approximateBytes += sizeof(DeviceBackend) + backend->m_udi.size() * sizeof(QChar);
+
+            QMutexLocker locker(&backend->m_cacheLock);
+            if (backend->hasCachedData()) {
+                ++stats.cachedBackends;
+            }
+            Q_FOREACH (const DeviceBackend::InterfaceCache &cache, backend->m_interfaceCaches) {
+                stats.cachedProperties += cache.props.size();
+                QMapIterator<QString, QVariant> prop(cache.props);
+                while (prop.hasNext()) {
+                    prop.next();
+                    stats.approximateBytes += sizeof(QString) + sizeof(QVariant) + prop.key().size() * sizeof(QChar) + approximateSize(prop.value());
+                }
+            }
+            stats.cachedProperties += backend->m_missingProperties.size();
+            Q_FOREACH (const QString &key, backend->m_missingProperties) {
+                stats.approximateBytes += sizeof(QString) + key.size() * sizeof(QChar);
+            }
+        }
+    }
+
+    return stats;
+}
+
+DeviceBackend::Ptr DeviceBackend::backendForUDI(const QString &udi, bool create)
+{
+    Ptr backend;
     if (udi.isEmpty()) {
         return backend;
     }
 
-    if (s_backends.contains(udi)) {
-        backend = s_backends.value(udi);
-    } else if (create) {
-        backend = new DeviceBackend(udi);
-        s_backends.insert(udi, backend);
+    BackendRegistry::Shard &shard = s_registry->shardFor(udi);
+    {
+        QReadLocker locker(&shard.lock);
+        backend = shard.backends.value(udi);
+    }
+
+    if (backend || !create) {
+        return backend;
+    }
+
+    // the constructor introspects the device over D-Bus, don't block the shard meanwhile
+    DeviceBackend *candidate = new DeviceBackend(udi);
+
+    QWriteLocker locker(&shard.lock);
+    backend = shard.backends.value(udi);
+    if (backend) {
+        // somebody was faster; nobody else has seen ours
+        delete candidate;
+        return backend;
+    }
+
+    // a worker thread may have no event loop to deliver our D-Bus signals
+    QThread *home = QCoreApplication::instance() ? QCoreApplication::instance()->thread() : nullptr;
+    if (home && home != candidate->thread()) {
+        candidate->moveToThread(home);
     }
 
+    backend = Ptr(candidate, &QObject::deleteLater);
+    shard.backends.insert(udi, backend);
     return backend;
 }
 
 void DeviceBackend::destroyBackend(const QString &udi)
 {
-    if (s_backends.contains(udi)) {
-        DeviceBackend *backend = s_backends.value(udi);
-        s_backends.remove(udi);
-        delete backend;
+    BackendRegistry::Shard &shard = s_registry->shardFor(udi);
+    Ptr backend;
+    {
+        QWriteLocker locker(&shard.lock);
+        backend = shard.backends.take(udi);
     }
+
+    // whoever still holds a reference keeps using a backend without cache
+    if (backend) {
+        backend->invalidateProperties();
+    }
+}
+
+DeviceBackend::CacheStatistics DeviceBackend::cacheStatistics()
+{
+    return s_registry->statistics();
+}
+
+void DeviceBackend::postChanged(const QString &udi, const QStringList &keys)
+{
+    // our reference keeps the backend alive until the call is queued
+    const Ptr backend = backendForUDI(udi, false);
+    if (backend) {
+        QMetaObject::invokeMethod(backend.data(), "notifyChanged", Qt::QueuedConnection, Q_ARG(QStringList, keys));
+    }
+}
+
+void DeviceBackend::setJobProperties(const QVariantMap &props)
+{
+    QStringList keys;
+    {
+        QMutexLocker locker(&m_cacheLock);
+        keys = m_jobProperties.keys();
+        QMapIterator<QString, QVariant> i(props);
+        while (i.hasNext()) {
+            i.next();
+            if (m_jobProperties.value(i.key()) == i.value()) {
+                keys.removeAll(i.key());
+            } else if (!keys.contains(i.key())) {
+                keys << i.key();
+            }
+        }
+        m_jobProperties = props;
+    }
+
+    if (keys.isEmpty()) {
+        return;
+    }
+
+    if (thread() == QThread::currentThread()) {
+        notifyChanged(keys);
+    } else {
+        QMetaObject::invokeMethod(this, "notifyChanged", Qt::QueuedConnection, Q_ARG(QStringList, keys));
+    }
+}
+
+void DeviceBackend::notifyChanged(const QStringList &keys)
+{
+    QMap<QString, int> changeMap;
+    Q_FOREACH (const QString &key, keys) {
+        changeMap.insert(key, Solid::GenericInterface::PropertyModified);
+    }
+
+    if (affectsPresentation(keys)) {
+        m_presentationGeneration.ref();
+    }
+
+    emit propertyChanged(changeMap);
+    emit changed();
 }
 
 DeviceBackend::DeviceBackend(const QString &udi)
-    : m_udi(udi)
+    : m_presentationGeneration(0)
+    , m_lastAccess(0)
+    , m_udi(udi)
 {
     //qDebug() << "Creating backend for device" << m_udi;
     m_device = new QDBusInterface(UD2_DBUS_SERVICE, m_udi,
@@ -87,9 +314,10 @@ DeviceBackend::~DeviceBackend()
 
 void DeviceBackend::initInterfaces()
 {
+    const QString xmlData = introspect();
+    QMutexLocker locker(&m_cacheLock);
     m_interfaces.clear();
 
-    const QString xmlData = introspect();
     if (xmlData.isEmpty()) {
         qDebug() << m_udi << "has no interfaces!";
         return;
@@ -113,6 +341,7 @@ void DeviceBackend::initInterfaces()
 
 QStringList DeviceBackend::interfaces() const
 {
+    QMutexLocker locker(&m_cacheLock);
     return m_interfaces;
 }
 
@@ -123,40 +352,349 @@ const QString &DeviceBackend::udi() const
 
 QVariant DeviceBackend::prop(const QString &key) const
 {
-    checkCache(key);
-    return m_propertyCache.value(key);
+    return cachedProperty(key);
 }
 
 bool DeviceBackend::propertyExists(const QString &key) const
 {
-    checkCache(key);
-    /* checkCache() will put an invalid QVariant in cache when the property
-     * does not exist, so check for validity, not for an actual presence. */
-    return m_propertyCache.value(key).isValid();
+    /* cachedProperty() remembers properties that do not exist and returns an
+     * invalid QVariant for them, so check for validity, not for an actual presence. */
+    return cachedProperty(key).isValid();
 }
 
 QVariantMap DeviceBackend::allProperties() const
 {
-    QDBusMessage call = QDBusMessage::createMethodCall(UD2_DBUS_SERVICE, m_udi, DBUS_INTERFACE_PROPS, "GetAll");
+    touch();
+
+    Q_FOREACH (const QString &iface, interfaces()) {
+        quint32 generation;
+        {
+            QMutexLocker locker(&m_cacheLock);
+            const InterfaceCache &cache = m_interfaceCaches[iface];
+            if (cache.complete) {
+                continue;
+            }
+            generation = cache.generation;
+        }
+        storeInterface(iface, fetchInterface(iface), generation);
+    }
 
-    Q_FOREACH (const QString &iface, m_interfaces) {
-        call.setArguments(QVariantList() << iface);
-        QDBusPendingReply<QVariantMap> reply = QDBusConnection::systemBus().call(call);
+    QVariantMap props;
+    QMutexLocker locker(&m_cacheLock);
+    Q_FOREACH (const InterfaceCache &cache, m_interfaceCaches) {
+        props.unite(cache.props);
+    }
+    props.unite(m_jobProperties);
+    return props;
+}
 
-        if (reply.isValid()) {
-            m_propertyCache.unite(reply.value());
-        } else {
-            qWarning() << "Error getting props:" << reply.error().name() << reply.error().message();
+void DeviceBackend::invalidateProperties()
+{
+    QMutexLocker locker(&m_cacheLock);
+    const bool wasCached = hasCachedData();
+
+    // negative entries stay: the set of interfaces, and so of properties, is unchanged
+    for (QHash<QString, InterfaceCache>::iterator it = m_interfaceCaches.begin(); it != m_interfaceCaches.end(); ++it) {
+        dropInterface(it.value());
+    }
+    m_propertyInterface.clear();
+    unresolveInterfaceLinks(m_interfaces);
+    m_presentationGeneration.ref();
+
+    updateAccounting(wasCached);
+}
+
+void DeviceBackend::invalidateInterface(const QString &iface)
+{
+    QMutexLocker locker(&m_cacheLock);
+    const bool wasCached = hasCachedData();
+
+    QHash<QString, InterfaceCache>::iterator it = m_interfaceCaches.find(iface);
+    if (it != m_interfaceCaches.end()) {
+        dropInterface(it.value());
+    }
+    unresolveInterfaceLinks(QStringList() << iface);
+    m_presentationGeneration.ref();
+
+    updateAccounting(wasCached);
+}
+
+void DeviceBackend::interfacesAdded(const VariantMapMap &interfaces_and_properties)
+{
+    bool becameCached = false;
+    {
+        QMutexLocker locker(&m_cacheLock);
+        const bool wasCached = hasCachedData();
+
+        QMapIterator<QString, QVariantMap> i(interfaces_and_properties);
+        while (i.hasNext()) {
+            i.next();
+            /* Don't store generic DBus interfaces */
+            if (!i.key().startsWith(UD2_DBUS_SERVICE)) {
+                continue;
+            }
+            if (!m_interfaces.contains(i.key())) {
+                m_interfaces.append(i.key());
+                // the new interface may provide properties we remembered as missing
+                m_missingProperties.clear();
+            }
+
+            // the signal carries the complete property set of the interface
+            InterfaceCache &cache = m_interfaceCaches[i.key()];
+            dropInterface(cache);
+            setInterface(i.key(), cache, i.value());
+            unresolveLinks(i.value().keys());
         }
-        //qDebug() << "After iface" << iface << ", cache now contains" << m_cache.size() << "items";
+        m_presentationGeneration.ref();
+
+        becameCached = updateAccounting(wasCached);
     }
 
-    return m_propertyCache;
+    if (becameCached) {
+        s_registry->trim(this);
+    }
 }
 
-void DeviceBackend::invalidateProperties()
+void DeviceBackend::interfacesRemoved(const QStringList &interfaces)
+{
+    QMutexLocker locker(&m_cacheLock);
+    const bool wasCached = hasCachedData();
+
+    Q_FOREACH (const QString &iface, interfaces) {
+        if (m_interfaces.removeAll(iface) > 0) {
+            m_missingProperties.clear();
+        }
+
+        QHash<QString, InterfaceCache>::iterator it = m_interfaceCaches.find(iface);
+        if (it != m_interfaceCaches.end()) {
+            dropInterface(it.value());
+        }
+    }
+    unresolveInterfaceLinks(interfaces);
+    m_presentationGeneration.ref();
+
+    updateAccounting(wasCached);
+}
+
+const char *DeviceBackend::linkProperty(Link which)
 {
-    m_propertyCache.clear();
+    static const char *const properties[LinkCount] = {
+        "Drive", "Table", "CryptoBackingDevice", "CleartextDevice"
+    };
+    return properties[which];
+}
+
+const char *DeviceBackend::linkInterface(Link which)
+{
+    static const char *const interfaces[LinkCount] = {
+        UD2_DBUS_INTERFACE_BLOCK, UD2_DBUS_INTERFACE_PARTITION, UD2_DBUS_INTERFACE_BLOCK, UD2_DBUS_INTERFACE_ENCRYPTED
+    };
+    return interfaces[which];
+}
+
+DeviceBackend::Ptr DeviceBackend::link(Link which) const
+{
+    resolveLink(which);
+    QMutexLocker locker(&m_cacheLock);
+    return m_links[which].backend.toStrongRef();
+}
+
+QString DeviceBackend::linkPath(Link which) const
+{
+    resolveLink(which);
+    QMutexLocker locker(&m_cacheLock);
+    return m_links[which].path;
+}
+
+void DeviceBackend::setLink(Link which, const QString &udi)
+{
+    storeLink(which, udi, true);
+}
+
+void DeviceBackend::storeLink(Link which, const QString &udi, bool learned) const
+{
+    const Ptr target = (udi.isEmpty() || udi == "/") ? Ptr() : backendForUDI(udi);
+
+    QMutexLocker locker(&m_cacheLock);
+    if (!learned && m_links[which].resolved) {
+        return; // setLink() was faster than our property read
+    }
+    m_links[which].path = udi;
+    m_links[which].backend = target;
+    m_links[which].resolved = true;
+    m_links[which].learned = learned;
+}
+
+void DeviceBackend::resolveLink(Link which) const
+{
+    {
+        QMutexLocker locker(&m_cacheLock);
+        if (m_links[which].resolved) {
+            return;
+        }
+    }
+
+    const QVariant value = prop(QLatin1String(linkProperty(which)));
+    storeLink(which, value.isValid() ? value.value<QDBusObjectPath>().path() : QString(), false);
+}
+
+void DeviceBackend::unresolveLinks(const QStringList &keys) const
+{
+    for (int i = 0; i < LinkCount; ++i) {
+        if (keys.contains(QLatin1String(linkProperty(Link(i))))) {
+            m_links[i].resolved = false;
+            m_links[i].learned = false;
+        }
+    }
+}
+
+void DeviceBackend::unresolveInterfaceLinks(const QStringList &interfaces) const
+{
+    for (int i = 0; i < LinkCount; ++i) {
+        if (!m_links[i].learned && interfaces.contains(QLatin1String(linkInterface(Link(i))))) {
+            m_links[i].resolved = false;
+        }
+    }
+}
+
+bool DeviceBackend::affectsPresentation(const QStringList &keys)
+{
+    // what Device::description() and Device::icon() read, from the device or its drive
+    static const char *const dependencies[] = {
+        "AvailableContent", "ConnectionBus", "CryptoBackingDevice", "Drive", "HintIconName",
+        "HintName", "IdLabel", "IdType", "Media", "MediaAvailable", "MediaCompatibility", "MediaRemovable",
+        "Model", "Name", "Optical", "OpticalBlank", "OpticalNumAudioTracks", "OpticalNumDataTracks",
+        "Removable", "Size", "Vendor"
+    };
+
+    Q_FOREACH (const QString &key, keys) {
+        for (const char *dependency : dependencies) {
+            if (key == QLatin1String(dependency)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+quint32 DeviceBackend::presentationGeneration() const
+{
+    return m_presentationGeneration.load();
+}
+
+bool DeviceBackend::cachedPresentation(PresentationField field, quint64 stamp, QString *value) const
+{
+    QMutexLocker locker(&m_cacheLock);
+    const PresentationCache &cache = m_presentation[field];
+    if (!cache.valid || cache.stamp != stamp) {
+        return false;
+    }
+
+    *value = cache.value;
+    return true;
+}
+
+void DeviceBackend::storePresentation(PresentationField field, quint64 stamp, const QString &value) const
+{
+    s_registry->presentationRecomputations.ref();
+
+    QMutexLocker locker(&m_cacheLock);
+    PresentationCache &cache = m_presentation[field];
+    cache.value = value;
+    cache.stamp = stamp;
+    cache.valid = true;
+}
+
+quint32 DeviceBackend::lastAccess() const
+{
+    return m_lastAccess.load();
+}
+
+void DeviceBackend::touch() const
+{
+    m_lastAccess.store(s_registry->clock.fetchAndAddRelaxed(1) + 1);
+}
+
+bool DeviceBackend::hasCachedData() const
+{
+    if (!m_missingProperties.isEmpty()) {
+        return true;
+    }
+    Q_FOREACH (const InterfaceCache &cache, m_interfaceCaches) {
+        if (!cache.props.isEmpty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DeviceBackend::updateAccounting(bool wasCached) const
+{
+    const bool isCached = hasCachedData();
+    if (isCached && !wasCached) {
+        s_registry->cachedBackends.ref();
+        return true;
+    } else if (!isCached && wasCached) {
+        s_registry->cachedBackends.deref();
+    }
+    return false;
+}
+
+void DeviceBackend::dropInterface(InterfaceCache &cache) const
+{
+    /* Keys keep pointing at their interface in m_propertyInterface, so that the next
+     * access refetches only this interface. The generation bump turns any fetch of it
+     * that is still in flight into a stale one. */
+    cache.props.clear();
+    cache.complete = false;
+    ++cache.generation;
+}
+
+void DeviceBackend::setInterface(const QString &iface, InterfaceCache &cache, const QVariantMap &props) const
+{
+    cache.props = props;
+    cache.complete = true;
+
+    QMapIterator<QString, QVariant> i(props);
+    while (i.hasNext()) {
+        i.next();
+        m_propertyInterface.insert(i.key(), iface);
+        m_missingProperties.remove(i.key());
+    }
+}
+
+QVariantMap DeviceBackend::fetchInterface(const QString &iface) const
+{
+    QDBusMessage call = QDBusMessage::createMethodCall(UD2_DBUS_SERVICE, m_udi, DBUS_INTERFACE_PROPS, "GetAll");
+    call.setArguments(QVariantList() << iface);
+    QDBusPendingReply<QVariantMap> reply = QDBusConnection::systemBus().call(call);
+
+    if (!reply.isValid()) {
+        qWarning() << "Error getting props:" << reply.error().name() << reply.error().message();
+        return QVariantMap();
+    }
+
+    return reply.value();
+}
+
+void DeviceBackend::storeInterface(const QString &iface, const QVariantMap &props, quint32 generation) const
+{
+    bool becameCached;
+    {
+        QMutexLocker locker(&m_cacheLock);
+        InterfaceCache &cache = m_interfaceCaches[iface];
+        if (cache.generation != generation) { // invalidated while we were fetching it
+            return;
+        }
+
+        const bool wasCached = hasCachedData();
+        setInterface(iface, cache, props);
+        becameCached = updateAccounting(wasCached);
+    }
+
+    if (becameCached) {
+        s_registry->trim(this);
+    }
 }
 
 QString DeviceBackend::introspect() const
@@ -172,29 +710,95 @@ QString DeviceBackend::introspect() const
     }
 }
 
-void DeviceBackend::checkCache(const QString &key) const
+QVariant DeviceBackend::cachedProperty(const QString &key) const
 {
-    if (m_propertyCache.isEmpty()) { // recreate the cache
-        allProperties();
+    touch();
+
+    QString keyIface;
+    QStringList toFetch;
+    quint32 generation = 0;
+    {
+        QMutexLocker locker(&m_cacheLock);
+        QVariantMap::const_iterator job = m_jobProperties.constFind(key);
+        if (job != m_jobProperties.constEnd()) {
+            return job.value();
+        }
+        if (m_missingProperties.contains(key)) {
+            return QVariant();
+        }
+
+        keyIface = m_propertyInterface.value(key);
+        if (!keyIface.isEmpty()) {
+            const InterfaceCache &cache = m_interfaceCaches[keyIface];
+            QVariantMap::const_iterator it = cache.props.constFind(key);
+            if (it != cache.props.constEnd()) {
+                return it.value();
+            }
+            generation = cache.generation;
+            if (!cache.complete) {
+                toFetch << keyIface;
+            }
+        } else {
+            // we don't know who provides the key yet, load whatever hasn't been loaded
+            Q_FOREACH (const QString &iface, m_interfaces) {
+                if (!m_interfaceCaches.value(iface).complete) {
+                    toFetch << iface;
+                }
+            }
+        }
     }
 
-    if (m_propertyCache.contains(key)) {
-        return;
+    Q_FOREACH (const QString &iface, toFetch) {
+        quint32 ifaceGeneration;
+        {
+            QMutexLocker locker(&m_cacheLock);
+            ifaceGeneration = m_interfaceCaches[iface].generation;
+        }
+        const QVariantMap props = fetchInterface(iface);
+        storeInterface(iface, props, ifaceGeneration);
+        if (props.contains(key)) {
+            return props.value(key);
+        }
     }
 
     QDBusMessage call = QDBusMessage::createMethodCall(UD2_DBUS_SERVICE, m_udi, DBUS_INTERFACE_PROPS, "Get");
     /*
-     * Interface is set to an empty string as in this QDBusInterface is a meta-object of multiple interfaces on the same path
+     * When the providing interface is not known, it is set to an empty string as in this QDBusInterface
+     * is a meta-object of multiple interfaces on the same path.
      * The DBus properties also interface supports this, and will find the appropriate interface if none is explicitly set.
      * This matches what QDBusAbstractInterface would do
      */
-    call.setArguments(QVariantList() << QString() << key);
+    call.setArguments(QVariantList() << keyIface << key);
     QDBusPendingReply<QVariant> reply = QDBusConnection::systemBus().call(call);
+    const QVariant value = reply.value();
+
+    bool becameCached;
+    {
+        QMutexLocker locker(&m_cacheLock);
+        const bool wasCached = hasCachedData();
+        if (!value.isValid()) {
+            /* We don't check for error here and remember the item anyway so next time we don't have to
+             * do the DBus call to find out it does not exist but just check whether
+             * prop(key).isValid() */
+            m_missingProperties.insert(key);
+        } else if (!keyIface.isEmpty()) {
+            InterfaceCache &cache = m_interfaceCaches[keyIface];
+            if (cache.generation == generation) {
+                cache.props.insert(key, value);
+            }
+        } else {
+            // provided by an interface we don't track; keep it with the path-wide entries
+            m_interfaceCaches[QString()].props.insert(key, value);
+            m_propertyInterface.insert(key, QString());
+        }
+        becameCached = updateAccounting(wasCached);
+    }
 
-    /* We don't check for error here and store the item in the cache anyway so next time we don't have to
-     * do the DBus call to find out it does not exist but just check whether
-     * prop(key).isValid() */
-    m_propertyCache.insert(key, reply.value());
+    if (becameCached) {
+        s_registry->trim(this);
+    }
+
+    return value;
 }
 
 void DeviceBackend::slotPropertiesChanged(const QString &ifaceName, const QVariantMap &changedProps, const QStringList &invalidatedProps)
@@ -206,19 +810,41 @@ void DeviceBackend::slotPropertiesChanged(const QString &ifaceName, const QVaria
 
     QMap<QString, int> changeMap;
 
-    Q_FOREACH (const QString &key, invalidatedProps) {
-        m_propertyCache.remove(key);
-        changeMap.insert(key, Solid::GenericInterface::PropertyModified);
-        //qDebug() << "\t invalidated:" << key;
-    }
+    {
+        QMutexLocker locker(&m_cacheLock);
+        const bool wasCached = hasCachedData();
+        InterfaceCache &cache = m_interfaceCaches[ifaceName];
+
+        Q_FOREACH (const QString &key, invalidatedProps) {
+            // only this key is refetched, on its next access
+            cache.props.remove(key);
+            m_propertyInterface.insert(key, ifaceName);
+            changeMap.insert(key, Solid::GenericInterface::PropertyModified);
+            //qDebug() << "\t invalidated:" << key;
+        }
 
-    QMapIterator<QString, QVariant> i(changedProps);
-    while (i.hasNext()) {
-        i.next();
-        const QString key = i.key();
-        m_propertyCache.insert(key, i.value());  // replace the value
-        changeMap.insert(key, Solid::GenericInterface::PropertyModified);
-        //qDebug() << "\t modified:" << key << ":" << m_propertyCache.value(key);
+        QMapIterator<QString, QVariant> i(changedProps);
+        while (i.hasNext()) {
+            i.next();
+            const QString key = i.key();
+            cache.props.insert(key, i.value());  // replace the value
+            m_propertyInterface.insert(key, ifaceName);
+            m_missingProperties.remove(key);
+            changeMap.insert(key, Solid::GenericInterface::PropertyModified);
+            //qDebug() << "\t modified:" << key << ":" << i.value();
+        }
+
+        // a GetAll or Get started before this signal returns older values, it must
+        // not overwrite what we were just told
+        if (!changeMap.isEmpty()) {
+            ++cache.generation;
+        }
+
+        unresolveLinks(changeMap.keys());
+        if (affectsPresentation(changeMap.keys())) {
+            m_presentationGeneration.ref();
+        }
+        updateAccounting(wasCached);
     }
 
     emit propertyChanged(changeMap);
@@ -231,12 +857,7 @@ void DeviceBackend::slotInterfacesAdded(const QDBusObjectPath &object_path, cons
         return;
     }
 
-    Q_FOREACH (const QString &iface, interfaces_and_properties.keys()) {
-        /* Don't store generic DBus interfaces */
-        if (iface.startsWith(UD2_DBUS_SERVICE)) {
-            m_interfaces.append(iface);
-        }
-    }
+    interfacesAdded(interfaces_and_properties);
 }
 
 void DeviceBackend::slotInterfacesRemoved(const QDBusObjectPath &object_path, const QStringList &interfaces)
@@ -245,7 +866,5 @@ void DeviceBackend::slotInterfacesRemoved(const QDBusObjectPath &object_path, co
         return;
     }
 
-    Q_FOREACH (const QString &iface, interfaces) {
-        m_interfaces.removeAll(iface);
-    }
+    interfacesRemoved(interfaces);
 }
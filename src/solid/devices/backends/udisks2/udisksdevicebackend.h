@@ -24,6 +24,12 @@
 #define UDISKSDEVICEBACKEND_H
 
 #include <QObject>
+#include <QAtomicInteger>
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+#include <QSharedPointer>
+#include <QWeakPointer>
 #include <QtDBus/QDBusConnection>
 #include <QtDBus/QDBusObjectPath>
 #include <QtDBus/QDBusInterface>
@@ -44,8 +50,44 @@ class DeviceBackend: public QObject
     Q_OBJECT
 
 public:
-    static DeviceBackend *backendForUDI(const QString &udi, bool create = true);
+    /**
+     * Backends are shared between threads; a reference keeps one alive after
+     * it left the registry, and it is deleted on its own thread once the last
+     * reference is gone.
+     */
+    typedef QSharedPointer<DeviceBackend> Ptr;
+
+    /**
+     * Footprint of the process-wide backend registry.
+     */
+    struct CacheStatistics {
+        int backends;          // registered backends
+        int cachedBackends;    // backends currently holding a property cache
+        int cachedProperties;  // cached entries, including negative ones
+        qint64 approximateBytes;
+        qint64 evictions;      // property caches dropped to honour the limit
+        qint64 presentationRecomputations; // descriptions and icons computed, not served from memory
+    };
+
+    /**
+     * The registry is shared by the managers of all threads. When
+     * SOLID_UDISKS2_CACHE_LIMIT is set to a positive number, at most that many
+     * backends keep their property cache; the least recently used ones are
+     * dropped and refetched on their next access.
+     *
+     * New backends live on the thread of the application object, whose event
+     * loop delivers their D-Bus signals whichever thread created them.
+     */
+    static Ptr backendForUDI(const QString &udi, bool create = true);
     static void destroyBackend(const QString &udi);
+    static CacheStatistics cacheStatistics();
+
+    /**
+     * Emits the change signals of the backend of @p udi, if it still exists, on
+     * the backend's thread. For properties Solid derives itself and which are
+     * computed elsewhere, e.g. on a worker thread.
+     */
+    static void postChanged(const QString &udi, const QStringList &keys);
 
     DeviceBackend(const QString &udi);
     ~DeviceBackend();
@@ -58,6 +100,64 @@ public:
     const QString &udi() const;
 
     void invalidateProperties();
+    void invalidateInterface(const QString &iface);
+
+    /* Idempotent, so that the manager can feed the object manager signals before
+     * the backend receives them itself */
+    void interfacesAdded(const VariantMapMap &interfaces_and_properties);
+    void interfacesRemoved(const QStringList &interfaces);
+
+    quint32 lastAccess() const;
+
+    /**
+     * Links of the storage topology: a block points to its drive, a partition
+     * to its partition table, an unlocked cleartext device to its encrypted
+     * container and the container to its cleartext device.
+     */
+    enum Link {
+        DriveLink = 0,
+        TableLink,
+        CryptoBackingLink,
+        CleartextLink,
+        LinkCount
+    };
+
+    /**
+     * Resolved target of a link, null when the link is not set. Links are
+     * resolved once and kept until the property they come from changes.
+     * Links set with setLink() were learned from elsewhere, because older
+     * udisks don't expose their property; they survive the invalidation of
+     * their interface.
+     */
+    Ptr link(Link which) const;
+    QString linkPath(Link which) const;
+    void setLink(Link which, const QString &udi);
+
+    /**
+     * Descriptions and icons are derived from many properties of the device and
+     * of its drive; they are remembered together with the presentation
+     * generations of both. The generation changes only when a property they
+     * depend on, or the set of interfaces, changes.
+     */
+    enum PresentationField {
+        DescriptionField = 0,
+        IconField,
+        PresentationFieldCount
+    };
+
+    Q_INVOKABLE void notifyChanged(const QStringList &keys);
+
+    /**
+     * Publishes the UDisks2 job running on this device as Job* properties
+     * (JobOperation, JobProgress, JobRate, JobBytes, JobExpectedEndTime, ...),
+     * an empty map removes them once the job is gone.
+     */
+    void setJobProperties(const QVariantMap &props);
+
+    quint32 presentationGeneration() const;
+    bool cachedPresentation(PresentationField field, quint64 stamp, QString *value) const;
+    void storePresentation(PresentationField field, quint64 stamp, const QString &value) const;
+
 Q_SIGNALS:
     void propertyChanged(const QMap<QString, int> &changeMap);
     void changed();
@@ -70,15 +170,66 @@ private Q_SLOTS:
 private:
     void initInterfaces();
     QString introspect() const;
-    void checkCache(const QString &key) const;
+    /* Properties are cached per D-Bus interface. The generation is bumped on each
+     * invalidation and change, so that a fetch which raced with it is not stored. */
+    struct InterfaceCache {
+        InterfaceCache() : generation(0), complete(false) {}
+        QVariantMap props;
+        quint32 generation;
+        bool complete; // props hold everything GetAll returned
+    };
+
+    struct LinkTarget {
+        LinkTarget() : resolved(false), learned(false) {}
+        QString path;
+        QWeakPointer<DeviceBackend> backend;
+        bool resolved;
+        bool learned; // set by setLink(), not read from the property
+    };
+
+    static const char *linkProperty(Link which);
+    static const char *linkInterface(Link which);
+    void storeLink(Link which, const QString &udi, bool learned) const;
+    void resolveLink(Link which) const;
+    // links whose property is among the keys
+    void unresolveLinks(const QStringList &keys) const;
+    // links coming from the interfaces, except learned ones
+    void unresolveInterfaceLinks(const QStringList &interfaces) const;
+
+    struct PresentationCache {
+        PresentationCache() : stamp(0), valid(false) {}
+        QString value;
+        quint64 stamp;
+        bool valid;
+    };
+
+    static bool affectsPresentation(const QStringList &keys);
+
+    QVariant cachedProperty(const QString &key) const;
+    QVariantMap fetchInterface(const QString &iface) const;
+    void storeInterface(const QString &iface, const QVariantMap &props, quint32 generation) const;
+    void setInterface(const QString &iface, InterfaceCache &cache, const QVariantMap &props) const;
+    void dropInterface(InterfaceCache &cache) const;
+    bool hasCachedData() const;
+    bool updateAccounting(bool wasCached) const;
+    void touch() const;
 
     QDBusInterface *m_device;
 
-    mutable QVariantMap m_propertyCache;
+    // guards the caches and m_interfaces; never held across D-Bus calls
+    mutable QMutex m_cacheLock;
+    mutable QHash<QString /* interface */, InterfaceCache> m_interfaceCaches;
+    mutable QHash<QString /* property */, QString /* interface */> m_propertyInterface;
+    mutable QSet<QString> m_missingProperties;
+    QVariantMap m_jobProperties;
+    mutable LinkTarget m_links[LinkCount];
+    QAtomicInteger<quint32> m_presentationGeneration;
+    mutable PresentationCache m_presentation[PresentationFieldCount];
+    mutable QAtomicInteger<quint32> m_lastAccess;
     QStringList m_interfaces;
     QString m_udi;
 
-    static QMap<QString, DeviceBackend *> s_backends;
+    friend class BackendRegistry;
 
 };
 
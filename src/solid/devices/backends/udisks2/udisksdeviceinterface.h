@@ -77,6 +77,11 @@ public:
         case Solid::DeviceInterface::PortableMediaPlayer:
         case Solid::DeviceInterface::Battery:
         case Solid::DeviceInterface::NetworkShare:
+        case Solid::DeviceInterface::NetworkInterface:
+        case Solid::DeviceInterface::Sensor:
+        case Solid::DeviceInterface::NumaNode:
+        case Solid::DeviceInterface::EnergyCounter:
+        case Solid::DeviceInterface::Pressure:
         case Solid::DeviceInterface::Unknown:
             break;
         case Solid::DeviceInterface::Last:
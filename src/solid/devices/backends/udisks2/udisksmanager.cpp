@@ -20,8 +20,10 @@
 
 #include "udisksmanager.h"
 #include "udisksdevicebackend.h"
+#include "udisksopticaldisc.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QFile>
 #include <QtDBus>
 #include <QtXml/QDomDocument>
 
@@ -34,7 +36,8 @@ Manager::Manager(QObject *parent)
     : Solid::Ifaces::DeviceManager(parent),
       m_manager(UD2_DBUS_SERVICE,
                 UD2_DBUS_PATH,
-                QDBusConnection::systemBus())
+                QDBusConnection::systemBus()),
+      m_jobsIntrospected(false)
 {
     m_supportedInterfaces
             << Solid::DeviceInterface::GenericInterface
@@ -101,11 +104,12 @@ QObject *Manager::createDevice(const QString &udi)
 QStringList Manager::devicesFromQuery(const QString &parentUdi, Solid::DeviceInterface::Type type)
 {
     QStringList result;
+    const quint32 mask = typeBit(type);
 
     if (!parentUdi.isEmpty()) {
         Q_FOREACH (const QString &udi, deviceCache()) {
-            Device device(udi);
-            if (device.queryDeviceInterface(type) && device.parentUdi() == parentUdi) {
+            const IndexEntry &entry = indexEntry(udi);
+            if ((entry.interfaces & mask) && entry.parentUdi == parentUdi) {
                 result << udi;
             }
         }
@@ -113,8 +117,7 @@ QStringList Manager::devicesFromQuery(const QString &parentUdi, Solid::DeviceInt
         return result;
     } else if (type != Solid::DeviceInterface::Unknown) {
         Q_FOREACH (const QString &udi, deviceCache()) {
-            Device device(udi);
-            if (device.queryDeviceInterface(type)) {
+            if (indexEntry(udi).interfaces & mask) {
                 result << udi;
             }
         }
@@ -125,10 +128,85 @@ QStringList Manager::devicesFromQuery(const QString &parentUdi, Solid::DeviceInt
     return deviceCache();
 }
 
+quint32 Manager::typeBit(Solid::DeviceInterface::Type type)
+{
+    if (type <= Solid::DeviceInterface::Unknown || type >= 32) {
+        return 0;
+    }
+    return 1u << type;
+}
+
+const Manager::IndexEntry &Manager::indexEntry(const QString &udi)
+{
+    QHash<QString, IndexEntry>::const_iterator it = m_deviceIndex.constFind(udi);
+    if (it != m_deviceIndex.constEnd()) {
+        return it.value();
+    }
+
+    IndexEntry entry;
+    entry.interfaces = 0;
+
+    Device device(udi);
+    Q_FOREACH (Solid::DeviceInterface::Type type, m_supportedInterfaces) {
+        if (device.queryDeviceInterface(type)) {
+            entry.interfaces |= typeBit(type);
+        }
+    }
+    entry.parentUdi = device.parentUdi();
+
+    // keep the entry in sync with the properties it was computed from
+    const DeviceBackend::Ptr backend = DeviceBackend::backendForUDI(udi, false);
+    if (backend) {
+        entry.drivePath = backend->linkPath(DeviceBackend::DriveLink);
+        connect(backend.data(), SIGNAL(propertyChanged(QMap<QString,int>)),
+                this, SLOT(slotBackendPropertyChanged(QMap<QString,int>)), Qt::UniqueConnection);
+    }
+
+    return m_deviceIndex.insert(udi, entry).value();
+}
+
+void Manager::invalidateIndex(const QString &udi)
+{
+    m_deviceIndex.remove(udi);
+
+    // blocks of a drive are classified using the drive's properties (optical discs)
+    QHash<QString, IndexEntry>::iterator it = m_deviceIndex.begin();
+    while (it != m_deviceIndex.end()) {
+        if (it.value().drivePath == udi) {
+            it = m_deviceIndex.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void Manager::slotBackendPropertyChanged(const QMap<QString, int> &changes)
+{
+    DeviceBackend *backend = qobject_cast<DeviceBackend *>(sender());
+    if (!backend) {
+        return;
+    }
+
+    static const char *const classifyingProps[] = {
+        "Drive", "Table", "Optical", "MediaCompatibility", "CryptoBackingDevice"
+    };
+    for (const char *key : classifyingProps) {
+        if (changes.contains(QLatin1String(key))) {
+            invalidateIndex(backend->udi());
+            return;
+        }
+    }
+}
+
 QStringList Manager::allDevices()
 {
     introspect("/org/freedesktop/UDisks2/block_devices", true /*checkOptical*/);
     introspect("/org/freedesktop/UDisks2/drives");
+    if (!m_jobsIntrospected) {
+        // jobs started before us, the later ones are announced by the object manager
+        m_jobsIntrospected = true;
+        introspectJobs();
+    }
 
     return m_deviceCache;
 }
@@ -181,14 +259,30 @@ void Manager::slotInterfacesAdded(const QDBusObjectPath &object_path, const Vari
 {
     const QString udi = object_path.path();
 
-    /* Ignore jobs */
     if (udi.startsWith(UD2_DBUS_PATH_JOBS)) {
+        if (interfaces_and_properties.contains(UD2_DBUS_INTERFACE_JOB)) {
+            trackJob(udi, interfaces_and_properties.value(UD2_DBUS_INTERFACE_JOB));
+        }
         return;
     }
 
     qDebug() << udi << "has new interfaces:" << interfaces_and_properties.keys();
 
-    updateBackend(udi);
+    // the signal already carries the properties of the new interfaces
+    const DeviceBackend::Ptr backend = DeviceBackend::backendForUDI(udi);
+    if (backend) {
+        backend->interfacesAdded(interfaces_and_properties);
+    }
+    invalidateIndex(udi);
+
+    // an unlocked container learns about its cleartext device, older udisks don't tell it
+    const QString backingPath = interfaces_and_properties.value(UD2_DBUS_INTERFACE_BLOCK).value("CryptoBackingDevice").value<QDBusObjectPath>().path();
+    if (!backingPath.isEmpty() && backingPath != "/") {
+        const DeviceBackend::Ptr backingBackend = DeviceBackend::backendForUDI(backingPath, false);
+        if (backingBackend) {
+            backingBackend->setLink(DeviceBackend::CleartextLink, udi);
+        }
+    }
 
     // new device, we don't know it yet
     if (!m_deviceCache.contains(udi)) {
@@ -205,20 +299,34 @@ void Manager::slotInterfacesRemoved(const QDBusObjectPath &object_path, const QS
 {
     const QString udi = object_path.path();
 
-    /* Ignore jobs */
     if (udi.startsWith(UD2_DBUS_PATH_JOBS)) {
+        if (interfaces.contains(UD2_DBUS_INTERFACE_JOB)) {
+            untrackJob(udi);
+        }
         return;
     }
 
     qDebug() << udi << "lost interfaces:" << interfaces;
 
-    updateBackend(udi);
+    const DeviceBackend::Ptr backend = DeviceBackend::backendForUDI(udi, false);
+    if (backend) {
+        if (interfaces.contains(UD2_DBUS_INTERFACE_BLOCK)) { // a locked cleartext device goes away
+            const QString backingPath = backend->prop("CryptoBackingDevice").value<QDBusObjectPath>().path();
+            const DeviceBackend::Ptr backingBackend = DeviceBackend::backendForUDI(backingPath, false);
+            if (backingBackend && backingBackend->linkPath(DeviceBackend::CleartextLink) == udi) {
+                backingBackend->setLink(DeviceBackend::CleartextLink, QString());
+            }
+        }
+        backend->interfacesRemoved(interfaces);
+    }
+    invalidateIndex(udi);
 
     Device device(udi);
 
     if (!udi.isEmpty() && (interfaces.isEmpty() || device.interfaces().isEmpty())) {
         emit deviceRemoved(udi);
         m_deviceCache.removeAll(udi);
+        m_deviceIndex.remove(udi);
         DeviceBackend::destroyBackend(udi);
     }
 }
@@ -232,22 +340,150 @@ void Manager::slotMediaChanged(const QDBusMessage &msg)
     }
 
     const QString udi = msg.path();
-    updateBackend(udi);
+    updateMedia(udi);
+    invalidateIndex(udi);
     qulonglong size = properties.value("Size").toULongLong();
     qDebug() << "MEDIA CHANGED in" << udi << "; size is:" << size;
 
     if (!m_deviceCache.contains(udi) && size > 0) { // we don't know the optdisc, got inserted
         m_deviceCache.append(udi);
+        OpticalDisc::probeContent(udi);
         emit deviceAdded(udi);
     }
 
     if (m_deviceCache.contains(udi) && size == 0) {  // we know the optdisc, got removed
         emit deviceRemoved(udi);
         m_deviceCache.removeAll(udi);
+        m_deviceIndex.remove(udi);
         DeviceBackend::destroyBackend(udi);
     }
 }
 
+void Manager::introspectJobs()
+{
+    QDBusMessage call = QDBusMessage::createMethodCall(UD2_DBUS_SERVICE, "/org/freedesktop/UDisks2/jobs",
+                        DBUS_INTERFACE_INTROSPECT, "Introspect");
+    QDBusPendingReply<QString> reply = QDBusConnection::systemBus().call(call);
+    if (!reply.isValid()) {
+        return; // no jobs running
+    }
+
+    QDomDocument dom;
+    dom.setContent(reply.value());
+    QDomNodeList nodeList = dom.documentElement().elementsByTagName("node");
+    for (int i = 0; i < nodeList.count(); i++) {
+        QDomElement nodeElem = nodeList.item(i).toElement();
+        if (nodeElem.isNull() || !nodeElem.hasAttribute("name")) {
+            continue;
+        }
+
+        const QString jobPath = UD2_DBUS_PATH_JOBS + nodeElem.attribute("name");
+        QDBusMessage getAll = QDBusMessage::createMethodCall(UD2_DBUS_SERVICE, jobPath, DBUS_INTERFACE_PROPS, "GetAll");
+        getAll.setArguments(QVariantList() << UD2_DBUS_INTERFACE_JOB);
+        QDBusPendingReply<QVariantMap> props = QDBusConnection::systemBus().call(getAll);
+        if (props.isValid()) {
+            trackJob(jobPath, props.value());
+        }
+    }
+}
+
+void Manager::trackJob(const QString &jobPath, const QVariantMap &props)
+{
+    const bool known = m_jobs.contains(jobPath);
+    Job &job = m_jobs[jobPath];
+    job.props = props;
+
+    // devices dropping out of the job must lose its properties too
+    QStringList affected = job.objects;
+    const QList<QDBusObjectPath> objects = qdbus_cast<QList<QDBusObjectPath> >(props.value("Objects"));
+    job.objects.clear();
+    Q_FOREACH (const QDBusObjectPath &object, objects) {
+        job.objects << object.path();
+        if (!affected.contains(object.path())) {
+            affected << object.path();
+        }
+    }
+
+    if (!known) {
+        qDebug() << "job" << jobPath << props.value("Operation").toString() << "started on" << job.objects;
+        QDBusConnection::systemBus().connect(UD2_DBUS_SERVICE, jobPath, DBUS_INTERFACE_PROPS, "PropertiesChanged", this,
+                                             SLOT(slotJobChanged(QDBusMessage)));
+    }
+
+    Q_FOREACH (const QString &udi, affected) {
+        publishJob(udi);
+    }
+}
+
+void Manager::untrackJob(const QString &jobPath)
+{
+    if (!m_jobs.contains(jobPath)) {
+        return;
+    }
+
+    QDBusConnection::systemBus().disconnect(UD2_DBUS_SERVICE, jobPath, DBUS_INTERFACE_PROPS, "PropertiesChanged", this,
+                                            SLOT(slotJobChanged(QDBusMessage)));
+
+    const Job job = m_jobs.take(jobPath);
+    qDebug() << "job" << jobPath << "finished on" << job.objects;
+
+    Q_FOREACH (const QString &udi, job.objects) {
+        publishJob(udi);
+    }
+}
+
+void Manager::publishJob(const QString &udi)
+{
+    const DeviceBackend::Ptr backend = DeviceBackend::backendForUDI(udi);
+    if (!backend) {
+        return;
+    }
+
+    // several jobs may work on the same device, show the most recently started one
+    QString jobPath;
+    qulonglong startTime = 0;
+    for (QHash<QString, Job>::const_iterator it = m_jobs.constBegin(); it != m_jobs.constEnd(); ++it) {
+        const qulonglong jobStart = it.value().props.value("StartTime").toULongLong();
+        if (it.value().objects.contains(udi) && (jobPath.isEmpty() || jobStart >= startTime)) {
+            jobPath = it.key();
+            startTime = jobStart;
+        }
+    }
+
+    QVariantMap jobProps;
+    if (!jobPath.isEmpty()) {
+        static const char *const keys[] = {
+            "Operation", "Progress", "ProgressValid", "Bytes", "Rate", "StartTime", "ExpectedEndTime", "Cancelable"
+        };
+        const QVariantMap &props = m_jobs.value(jobPath).props;
+        jobProps.insert("JobPath", jobPath);
+        for (const char *key : keys) {
+            const QVariant value = props.value(key);
+            if (value.isValid()) {
+                jobProps.insert(QLatin1String("Job") + QLatin1String(key), value);
+            }
+        }
+    }
+
+    backend->setJobProperties(jobProps);
+}
+
+void Manager::slotJobChanged(const QDBusMessage &msg)
+{
+    const QString jobPath = msg.path();
+    if (msg.arguments().count() < 2 || msg.arguments().at(0).toString() != UD2_DBUS_INTERFACE_JOB || !m_jobs.contains(jobPath)) {
+        return;
+    }
+
+    QVariantMap props = m_jobs.value(jobPath).props;
+    const QVariantMap changed = qdbus_cast<QVariantMap>(msg.arguments().at(1));
+    for (QVariantMap::const_iterator it = changed.constBegin(); it != changed.constEnd(); ++it) {
+        props.insert(it.key(), it.value());
+    }
+
+    trackJob(jobPath, props);
+}
+
 const QStringList &Manager::deviceCache()
 {
     if (m_deviceCache.isEmpty()) {
@@ -257,15 +493,20 @@ const QStringList &Manager::deviceCache()
     return m_deviceCache;
 }
 
-void Manager::updateBackend(const QString &udi)
+void Manager::updateMedia(const QString &udi)
 {
-    DeviceBackend *backend = DeviceBackend::backendForUDI(udi);
+    const DeviceBackend::Ptr backend = DeviceBackend::backendForUDI(udi);
     if (!backend) {
         return;
     }
 
-    //This doesn't emit "changed" signals. Signals are emitted later by DeviceBackend's slots
-    backend->allProperties();
+    // Only what describes the medium is refetched, on next access.
+    // This doesn't emit "changed" signals. Signals are emitted later by DeviceBackend's slots
+#if UDEV_FOUND
+    // udev re-probes the medium as well; don't hand out its old properties
+    UdevQt::DeviceCache::invalidate(QFile::decodeName(backend->prop("Device").toByteArray()));
+#endif
+    backend->invalidateInterface(UD2_DBUS_INTERFACE_BLOCK);
 
     QVariant driveProp = backend->prop("Drive");
     if (!driveProp.isValid()) {
@@ -273,10 +514,10 @@ void Manager::updateBackend(const QString &udi)
     }
 
     QDBusObjectPath drivePath = qdbus_cast<QDBusObjectPath>(driveProp);
-    DeviceBackend *driveBackend = DeviceBackend::backendForUDI(drivePath.path(), false);
+    const DeviceBackend::Ptr driveBackend = DeviceBackend::backendForUDI(drivePath.path(), false);
     if (!driveBackend) {
         return;
     }
 
-    driveBackend->invalidateProperties();
+    driveBackend->invalidateInterface(UD2_DBUS_INTERFACE_DRIVE);
 }
@@ -29,6 +29,7 @@
 #include <solid/devices/ifaces/devicemanager.h>
 
 #include <QtDBus/QDBusInterface>
+#include <QtCore/QHash>
 #include <QtCore/QSet>
 
 namespace Solid
@@ -55,14 +56,44 @@ private Q_SLOTS:
     void slotInterfacesAdded(const QDBusObjectPath &object_path, const VariantMapMap &interfaces_and_properties);
     void slotInterfacesRemoved(const QDBusObjectPath &object_path, const QStringList &interfaces);
     void slotMediaChanged(const QDBusMessage &msg);
+    void slotBackendPropertyChanged(const QMap<QString, int> &changes);
+    void slotJobChanged(const QDBusMessage &msg);
 
 private:
+    /**
+     * Precomputed classification of a device, so that queries don't need to
+     * wrap every UDI (and its drive) in a temporary Device.
+     */
+    struct IndexEntry {
+        quint32 interfaces; // bitmask of (1 << Solid::DeviceInterface::Type)
+        QString parentUdi;
+        QString drivePath;
+    };
+
+    /**
+     * A running UDisks2 job and the devices it works on.
+     */
+    struct Job {
+        QStringList objects;
+        QVariantMap props;
+    };
+
     const QStringList &deviceCache();
+    void introspectJobs();
+    void trackJob(const QString &jobPath, const QVariantMap &props);
+    void untrackJob(const QString &jobPath);
+    void publishJob(const QString &udi);
     void introspect(const QString &path, bool checkOptical = false);
-    void updateBackend(const QString &udi);
+    void updateMedia(const QString &udi);
+    const IndexEntry &indexEntry(const QString &udi);
+    void invalidateIndex(const QString &udi);
+    static quint32 typeBit(Solid::DeviceInterface::Type type);
     QSet<Solid::DeviceInterface::Type> m_supportedInterfaces;
     org::freedesktop::DBus::ObjectManager m_manager;
     QStringList m_deviceCache;
+    QHash<QString, IndexEntry> m_deviceIndex;
+    QHash<QString /* job path */, Job> m_jobs;
+    bool m_jobsIntrospected;
 };
 
 }
@@ -24,8 +24,23 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QLockFile>
 #include <QtCore/QMap>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QMutex>
+#include <QtCore/QRunnable>
+#include <QtCore/QSet>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+#include <QtCore/QtEndian>
+#include <QtCore/QAtomicInteger>
 #include <QtCore/QSharedMemory>
 #include <QtCore/QSystemSemaphore>
 #include <QtDBus/QDBusConnection>
@@ -34,121 +49,111 @@
 
 #include "udisks2.h"
 #include "udisksopticaldisc.h"
+#include "udisksdevicebackend.h"
 #include "soliddefs_p.h"
 
+static inline bool isDirName(const char *dirname, uint len, const char *wanted)
+{
+    // path table names are not null-terminated
+    return qstrlen(wanted) == len && qstrnicmp(dirname, wanted, len) == 0;
+}
+
 // inspired by http://cgit.freedesktop.org/hal/tree/hald/linux/probing/probe-volume.c
-static Solid::OpticalDisc::ContentType advancedDiscDetect(const QByteArray &device_file)
+// The primary volume descriptor and the path table are each read with a single pread(),
+// a spinning-up drive would otherwise pay for every small seek and read.
+// Returns false if the disc couldn't be read at all, e.g. while the drive spins up or
+// without permission; what it did read is a result, even if it holds no ISO9660 data.
+static bool advancedDiscDetect(const QByteArray &device_file, Solid::OpticalDisc::ContentType *content)
 {
-    /* the discs block size */
-    unsigned short bs;
-    /* the path table size */
-    unsigned short ts;
-    /* the path table location (in blocks) */
-    unsigned int tl;
-    /* length of the directory name in current path table entry */
-    unsigned char len_di = 0;
-    /* the number of the parent directory's path table entry */
-    unsigned int parent = 0;
-    /* filename for the current path table entry */
-    char dirname[256];
-    /* our position into the path table */
-    int pos = 0;
-    /* the path table record we're on */
-    int curr_record = 1;
+    /* the primary volume descriptor lives in sector 16 */
+    static const off_t pvdOffset = 0x8000;
+    /* path tables are small; anything bigger than this is not an ISO9660 path table */
+    static const quint32 maxPathTableSize = 1024 * 1024;
 
     Solid::OpticalDisc::ContentType result = Solid::OpticalDisc::NoContent;
+    *content = result;
 
     int fd = open(device_file.constData(), O_RDONLY);
-
-    /* read the block size */
-    lseek(fd, 0x8080, SEEK_CUR);
-    if (read(fd, &bs, 2) != 2) {
-        qDebug("Advanced probing on %s failed while reading block size", qPrintable(device_file));
-        goto out;
+    if (fd < 0) {
+        qDebug("Advanced probing on %s failed while opening the device", qPrintable(device_file));
+        return false;
     }
 
-    /* read in size of path table */
-    lseek(fd, 2, SEEK_CUR);
-    if (read(fd, &ts, 2) != 2) {
-        qDebug("Advanced probing on %s failed while reading path table size", qPrintable(device_file));
-        goto out;
+    uchar pvd[0x90];
+    const ssize_t pvdRead = pread(fd, pvd, sizeof(pvd), pvdOffset);
+    if (pvdRead != ssize_t(sizeof(pvd))) {
+        qDebug("Advanced probing on %s failed while reading the volume descriptor", qPrintable(device_file));
+        close(fd);
+        return false;
     }
 
-    /* read in which block path table is in */
-    lseek(fd, 6, SEEK_CUR);
-    if (read(fd, &tl, 4) != 4) {
-        qDebug("Advanced probing on %s failed while reading path table block", qPrintable(device_file));
-        goto out;
+    /* the discs block size */
+    const quint16 bs = qFromLittleEndian<quint16>(pvd + 0x80);
+    /* the path table size */
+    const quint32 ts = qFromLittleEndian<quint32>(pvd + 0x84);
+    /* the path table location (in blocks) */
+    const quint32 tl = qFromLittleEndian<quint32>(pvd + 0x8c);
+
+    if (ts == 0 || ts > maxPathTableSize) {
+        qDebug("Advanced probing on %s failed, unlikely path table size %u", qPrintable(device_file), ts);
+        close(fd);
+        return true;
     }
 
-    /* seek to the path table */
-    lseek(fd, bs * tl, SEEK_SET);
+    QByteArray table(ts, Qt::Uninitialized);
+    const ssize_t tableRead = pread(fd, table.data(), ts, off_t(bs) * tl);
+    close(fd);
+    if (tableRead <= 0) {
+        qDebug("Advanced probing on %s failed while reading the path table", qPrintable(device_file));
+        return false;
+    }
 
-    /* loop through the path table entries */
-    while (pos < ts) {
-        /* get the length of the filename of the current entry */
-        if (read(fd, &len_di, 1) != 1) {
-            qDebug("Advanced probing on %s failed, cannot read more entries", qPrintable(device_file));
-            break;
-        }
+    const uchar *entry = reinterpret_cast<const uchar *>(table.constData());
+    const uchar *end = entry + tableRead;
 
-        /* get the record number of this entry's parent
+    /* loop through the path table entries, each one is
+       name length (1), extended attribute length (1), extent (4), parent (2), name, padding */
+    while (entry + 8 <= end) {
+        /* length of the directory name in current path table entry */
+        const uchar len_di = entry[0];
+        /* the number of the parent directory's path table entry,
            i'm pretty sure that the 1st entry is always the top directory */
-        lseek(fd, 5, SEEK_CUR);
-        if (read(fd, &parent, 2) != 2) {
-            qDebug("Advanced probing on %s failed, couldn't read parent entry", qPrintable(device_file));
-            break;
-        }
+        const quint16 parent = qFromLittleEndian<quint16>(entry + 6);
+        const char *dirname = reinterpret_cast<const char *>(entry + 8);
 
-        /* read the name */
-        if (read(fd, dirname, len_di) != len_di) {
-            qDebug("Advanced probing on %s failed, couldn't read the entry name", qPrintable(device_file));
+        if (len_di == 0 || entry + 8 + len_di > end) {
+            qDebug("Advanced probing on %s failed, cannot read more entries", qPrintable(device_file));
             break;
         }
-        dirname[len_di] = 0;
 
         /* if we found a folder that has the root as a parent, and the directory name matches
            one of the special directories then set the properties accordingly */
         if (parent == 1) {
-            if (!strcasecmp(dirname, "VIDEO_TS")) {
+            if (isDirName(dirname, len_di, "VIDEO_TS")) {
                 qDebug("Disc in %s is a Video DVD", qPrintable(device_file));
                 result = Solid::OpticalDisc::VideoDvd;
                 break;
-            } else if (!strcasecmp(dirname, "BDMV")) {
+            } else if (isDirName(dirname, len_di, "BDMV")) {
                 qDebug("Disc in %s is a Blu-ray video disc", qPrintable(device_file));
                 result = Solid::OpticalDisc::VideoBluRay;
                 break;
-            } else if (!strcasecmp(dirname, "VCD")) {
+            } else if (isDirName(dirname, len_di, "VCD")) {
                 qDebug("Disc in %s is a Video CD", qPrintable(device_file));
                 result = Solid::OpticalDisc::VideoCd;
                 break;
-            } else if (!strcasecmp(dirname, "SVCD")) {
+            } else if (isDirName(dirname, len_di, "SVCD")) {
                 qDebug("Disc in %s is a Super Video CD", qPrintable(device_file));
                 result = Solid::OpticalDisc::SuperVideoCd;
                 break;
             }
         }
 
-        /* all path table entries are padded to be even,
-           so if this is an odd-length table, seek a byte to fix it */
-        if (len_di % 2 == 1) {
-            lseek(fd, 1, SEEK_CUR);
-            pos++;
-        }
-
-        /* update our position */
-        pos += 8 + len_di;
-        curr_record++;
+        /* all path table entries are padded to be even */
+        entry += 8 + len_di + (len_di % 2);
     }
 
-    close(fd);
-    return result;
-
-out:
-    /* go back to the start of the file */
-    lseek(fd, 0, SEEK_SET);
-    close(fd);
-    return result;
+    *content = result;
+    return true;
 }
 
 using namespace Solid::Backends::UDisks2;
@@ -199,6 +204,32 @@ private:
     QPair<OpticalDisc::Identity, Solid::OpticalDisc::ContentTypes> m_info[100];
 };
 
+/* Counters behind OpticalDisc::cacheStatistics() */
+static QAtomicInteger<qint64> s_semaphoreAcquisitions;
+static QAtomicInteger<qint64> s_semaphoreContended;
+static QAtomicInteger<qint64> s_semaphoreWaitNsecs;
+static QAtomicInteger<qint64> s_persistentHits;
+static QAtomicInteger<qint64> s_persistentMisses;
+static QAtomicInteger<qint64> s_persistentLockWaits;
+
+/* QSystemSemaphore can't try-acquire, so contention is told by the time spent waiting */
+static bool timedAcquire(QSystemSemaphore *semaphore)
+{
+    static const qint64 contendedNsecs = 100000;
+
+    QElapsedTimer timer;
+    timer.start();
+    const bool acquired = semaphore->acquire();
+    const qint64 waited = timer.nsecsElapsed();
+
+    s_semaphoreAcquisitions.ref();
+    s_semaphoreWaitNsecs.fetchAndAddRelaxed(waited);
+    if (waited > contendedNsecs) {
+        s_semaphoreContended.ref();
+    }
+    return acquired;
+}
+
 class SharedContentTypesCache
 {
 private:
@@ -265,29 +296,39 @@ public:
         m_pointer = new(m_shmem.data()) ContentTypesCache;
     }
 
-    Solid::OpticalDisc::ContentTypes getContent(const OpticalDisc::Identity &info,
-            const QByteArray &file)
+    bool findContent(const OpticalDisc::Identity &info, Solid::OpticalDisc::ContentTypes *content)
     {
-        if (!m_pointer) {
-            return advancedDiscDetect(file);
-        }
-
-        if (!m_semaphore.acquire()) {
-            return advancedDiscDetect(file);
+        if (!m_pointer || !timedAcquire(&m_semaphore)) {
+            return false;
         }
         Releaser releaser(&m_semaphore);
 
         if (!m_shmem.lock()) {
-            return advancedDiscDetect(file);
+            return false;
         }
         Unlocker unlocker(&m_shmem);
 
         if (!m_pointer->find(info)) {
-            m_pointer->add(info, advancedDiscDetect(file));
+            return false;
         }
 
-        Solid::OpticalDisc::ContentTypes content = m_pointer->front().second;
-        return content;
+        *content = m_pointer->front().second;
+        return true;
+    }
+
+    void addContent(const OpticalDisc::Identity &info, Solid::OpticalDisc::ContentTypes content)
+    {
+        if (!m_pointer || !timedAcquire(&m_semaphore)) {
+            return;
+        }
+        Releaser releaser(&m_semaphore);
+
+        if (!m_shmem.lock()) {
+            return;
+        }
+        Unlocker unlocker(&m_shmem);
+
+        m_pointer->add(info, content);
     }
 
     ~SharedContentTypesCache()
@@ -300,34 +341,319 @@ public:
 
 Q_GLOBAL_STATIC(SharedContentTypesCache, sharedContentTypesCache)
 
-OpticalDisc::Identity::Identity() : m_detectTime(0), m_size(0), m_labelHash(0)
+/* Content types of discs seen before, kept across sessions in the user's cache directory.
+ * The file is only ever replaced by an atomic rename, so readers never lock it and always
+ * see a complete table; writers serialise on a lock file. The detect time is not part of the
+ * key, it changes each time a disc is inserted. */
+class PersistentContentTypesCache
+{
+public:
+    PersistentContentTypesCache()
+        : m_fileName(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation)
+                     + QLatin1String("/solid/optical-content-1"))
+    {
+    }
+
+    bool findContent(const OpticalDisc::Identity &info, Solid::OpticalDisc::ContentTypes *content)
+    {
+        const Key key = keyFor(info);
+        if (!key.isValid()) {
+            return false;
+        }
+
+        QMutexLocker locker(&m_lock);
+        reload();
+        QHash<Key, quint32>::const_iterator it = m_entries.constFind(key);
+        if (it == m_entries.constEnd()) {
+            s_persistentMisses.ref();
+            return false;
+        }
+
+        s_persistentHits.ref();
+        *content = Solid::OpticalDisc::ContentTypes(it.value());
+        return true;
+    }
+
+    void addContent(const OpticalDisc::Identity &info, Solid::OpticalDisc::ContentTypes content)
+    {
+        const Key key = keyFor(info);
+        if (!key.isValid()) {
+            return;
+        }
+
+        QDir().mkpath(QFileInfo(m_fileName).absolutePath());
+        QLockFile fileLock(m_fileName + QLatin1String(".lock"));
+        if (!fileLock.tryLock(0)) {
+            s_persistentLockWaits.ref();
+            if (!fileLock.tryLock(1000)) {
+                return; // somebody else is busy with it, we'll probe this disc again next session
+            }
+        }
+
+        QMutexLocker locker(&m_lock);
+        reload();
+        m_order.removeAll(key);
+        m_order.append(key);
+        m_entries.insert(key, quint32(content));
+        while (m_order.size() > MaxEntries) {
+            m_entries.remove(m_order.takeFirst());
+        }
+
+        QSaveFile file(m_fileName);
+        if (!file.open(QIODevice::WriteOnly)) {
+            return;
+        }
+        QDataStream stream(&file);
+        stream << quint32(Magic) << quint32(m_order.size());
+        Q_FOREACH (const Key &entry, m_order) {
+            stream << entry.size << entry.labelHash << entry.uuidHash << m_entries.value(entry);
+        }
+        if (file.commit()) {
+            m_loaded = QFileInfo(m_fileName).lastModified();
+        }
+    }
+
+private:
+    enum { Magic = 0x534f4f43, MaxEntries = 512 };
+
+    struct Key {
+        qint64 size;
+        quint32 labelHash;
+        quint32 uuidHash;
+
+        bool isValid() const
+        {
+            // without a label or an UUID, discs of the same size can't be told apart
+            return size > 0 && (labelHash != 0 || uuidHash != 0);
+        }
+        bool operator==(const Key &other) const
+        {
+            return size == other.size && labelHash == other.labelHash && uuidHash == other.uuidHash;
+        }
+    };
+
+    friend uint qHash(const Key &key, uint seed)
+    {
+        return qHash(key.size, seed) ^ key.labelHash ^ (key.uuidHash << 1);
+    }
+
+    static Key keyFor(const OpticalDisc::Identity &info)
+    {
+        const Key key = { info.size(), info.labelHash(), info.uuidHash() };
+        return key;
+    }
+
+    // must be called with m_lock held; re-reads the file only when it was replaced
+    void reload()
+    {
+        const QFileInfo info(m_fileName);
+        const QDateTime modified = info.exists() ? info.lastModified() : QDateTime();
+        if (modified == m_loaded) {
+            return;
+        }
+        m_loaded = modified;
+        m_entries.clear();
+        m_order.clear();
+
+        QFile file(m_fileName);
+        if (!file.open(QIODevice::ReadOnly)) {
+            return;
+        }
+        QDataStream stream(&file);
+        quint32 magic;
+        quint32 count;
+        stream >> magic >> count;
+        if (magic != Magic || count > MaxEntries) {
+            return;
+        }
+        for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+            Key key;
+            quint32 content;
+            stream >> key.size >> key.labelHash >> key.uuidHash >> content;
+            if (stream.status() == QDataStream::Ok) {
+                m_order.append(key);
+                m_entries.insert(key, content);
+            }
+        }
+    }
+
+    const QString m_fileName;
+    QMutex m_lock;
+    QDateTime m_loaded;
+    QHash<Key, quint32> m_entries;
+    QList<Key> m_order; // oldest first
+};
+
+Q_GLOBAL_STATIC(PersistentContentTypesCache, persistentContentTypesCache)
+
+/* Discs whose content is being probed, so that each one is read only once */
+static QMutex s_probesLock;
+Q_GLOBAL_STATIC(QSet<QString>, s_pendingProbes)
+
+/* The last probe result of each device in this process, guarded by s_probesLock. The
+ * shared memory may be unavailable and discs without label or UUID don't go to disk;
+ * a finished probe would otherwise make the next query start another one. */
+struct ProbedContent {
+    OpticalDisc::Identity identity;
+    Solid::OpticalDisc::ContentTypes content;
+};
+typedef QHash<QString /* UDI */, ProbedContent> ProbedContentHash;
+Q_GLOBAL_STATIC(ProbedContentHash, s_probedContent)
+
+/* Looks in this process first, then in the on-disk cache: it needs neither the session
+ * semaphore nor the drive */
+static bool findCachedContent(const QString &udi, const OpticalDisc::Identity &identity, Solid::OpticalDisc::ContentTypes *content)
+{
+    {
+        QMutexLocker locker(&s_probesLock);
+        ProbedContentHash::const_iterator it = s_probedContent->constFind(udi);
+        if (it != s_probedContent->constEnd() && it->identity == identity) {
+            *content = it->content;
+            return true;
+        }
+    }
+
+    if (persistentContentTypesCache->findContent(identity, content)) {
+        sharedContentTypesCache->addContent(identity, *content);
+        return true;
+    }
+    return sharedContentTypesCache->findContent(identity, content);
+}
+
+OpticalDisc::CacheStatistics OpticalDisc::cacheStatistics()
+{
+    CacheStatistics stats = {
+        s_semaphoreAcquisitions.load(), s_semaphoreContended.load(), s_semaphoreWaitNsecs.load(),
+        s_persistentHits.load(), s_persistentMisses.load(), s_persistentLockWaits.load()
+    };
+    return stats;
+}
+
+/* Probes the content of a disc on a worker thread. The result is stored in the
+ * caches right away, the device is told about it on its own thread. A disc that
+ * can't be read, e.g. while the drive spins up, is tried again a few times; if it
+ * still fails, only this process remembers it has no known content, so that
+ * neither other processes nor later sessions inherit the failure. */
+class ContentProbe : public QRunnable
+{
+public:
+    ContentProbe(const QString &udi, const QByteArray &deviceFile, const OpticalDisc::Identity &identity)
+        : m_udi(udi)
+        , m_deviceFile(deviceFile)
+        , m_identity(identity)
+    {
+    }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        static const int attempts = 3;
+        static const unsigned long retryDelay = 1000;
+
+        Solid::OpticalDisc::ContentType detected = Solid::OpticalDisc::NoContent;
+        bool probed = false;
+        for (int i = 0; i < attempts && !probed; ++i) {
+            if (i > 0) {
+                QThread::msleep(retryDelay);
+            }
+            probed = advancedDiscDetect(m_deviceFile, &detected);
+        }
+
+        const Solid::OpticalDisc::ContentTypes content = detected;
+        if (probed) {
+            sharedContentTypesCache->addContent(m_identity, content);
+            persistentContentTypesCache->addContent(m_identity, content);
+        }
+
+        {
+            QMutexLocker locker(&s_probesLock);
+            const ProbedContent probed = { m_identity, content };
+            s_probedContent->insert(m_udi, probed);
+            s_pendingProbes->remove(m_udi);
+        }
+
+        DeviceBackend::postChanged(m_udi, QStringList() << QStringLiteral("AvailableContent"));
+    }
+
+private:
+    QString m_udi;
+    QByteArray m_deviceFile;
+    OpticalDisc::Identity m_identity;
+};
+
+bool OpticalDisc::probeContent(const QString &udi, const QByteArray &deviceFile, const Identity &identity)
+{
+    Solid::OpticalDisc::ContentTypes content;
+    if (findCachedContent(udi, identity, &content)) {
+        return false;
+    }
+
+    {
+        QMutexLocker locker(&s_probesLock);
+        if (s_pendingProbes->contains(udi)) {
+            return true;
+        }
+        s_pendingProbes->insert(udi);
+    }
+
+    ContentProbe *probe = new ContentProbe(udi, deviceFile, identity);
+    QThreadPool::globalInstance()->start(probe);
+    return true;
+}
+
+void OpticalDisc::probeContent(const QString &udi)
+{
+    const Device device(udi);
+    const QString drivePath = device.drivePath();
+    if (drivePath.isEmpty() || drivePath == "/") {
+        return;
+    }
+
+    const Device drive(drivePath);
+    if (drive.prop("OpticalBlank").toBool() || drive.prop("OpticalNumDataTracks").toUInt() == 0) {
+        return;
+    }
+
+    probeContent(udi, device.prop("Device").toByteArray(), Identity(device, drive));
+}
+
+OpticalDisc::Identity::Identity() : m_detectTime(0), m_size(0), m_labelHash(0), m_uuidHash(0)
 {
 }
 
 OpticalDisc::Identity::Identity(const Device &device, const Device &drive)
     : m_detectTime(drive.prop("TimeMediaDetected").toLongLong()),
       m_size(device.prop("Size").toLongLong()),
-      m_labelHash(qHash(device.prop("IdLabel").toString()))
+      m_labelHash(qHash(device.prop("IdLabel").toString())),
+      m_uuidHash(qHash(device.prop("IdUUID").toString()))
+{
+}
+
+long long OpticalDisc::Identity::size() const
 {
+    return m_size;
+}
+
+uint OpticalDisc::Identity::labelHash() const
+{
+    return m_labelHash;
+}
+
+uint OpticalDisc::Identity::uuidHash() const
+{
+    return m_uuidHash;
 }
 
 bool OpticalDisc::Identity::operator ==(const OpticalDisc::Identity &b) const
 {
     return m_detectTime == b.m_detectTime &&
            m_size == b.m_size &&
-           m_labelHash == b.m_labelHash;
+           m_labelHash == b.m_labelHash &&
+           m_uuidHash == b.m_uuidHash;
 }
 
 OpticalDisc::OpticalDisc(Device *dev)
     : StorageVolume(dev)
 {
-#if UDEV_FOUND
-    UdevQt::Client client(this);
-    m_udevDevice = client.deviceByDeviceFile(device());
-    //qDebug() << "udev device:" << m_udevDevice.name() << "valid:" << m_udevDevice.isValid();
-    /*qDebug() << "\tProperties:" << */ m_udevDevice.deviceProperties(); // initialize the properties DB so that it doesn't crash further down, #298416
-#endif
-
     m_drive = new Device(m_device->drivePath());
 }
 
@@ -357,9 +683,11 @@ bool OpticalDisc::isBlank() const
 
 bool OpticalDisc::isAppendable() const
 {
-    //qDebug() << "appendable prop" << m_udevDevice.deviceProperty("ID_CDROM_MEDIA_STATE");
 #if UDEV_FOUND
-    return m_udevDevice.deviceProperty("ID_CDROM_MEDIA_STATE").toString() == QLatin1String("appendable");
+    // the cache hands out devices with their properties DB initialized, #298416
+    const UdevQt::Device udevDevice = UdevQt::DeviceCache::deviceByDeviceFile(device());
+    //qDebug() << "appendable prop" << udevDevice.deviceProperty("ID_CDROM_MEDIA_STATE");
+    return udevDevice.deviceProperty("ID_CDROM_MEDIA_STATE").toString() == QLatin1String("appendable");
 #elif defined(Q_OS_FREEBSD)
     return m_device->prop("bsdisks_IsAppendable").toBool();
 #else
@@ -410,10 +738,15 @@ Solid::OpticalDisc::ContentTypes OpticalDisc::availableContent() const
 
         Identity newIdentity(*m_device, *m_drive);
         if (!(m_identity == newIdentity)) {
-            QByteArray deviceFile(m_device->prop("Device").toByteArray());
-            m_cachedContent =
-                sharedContentTypesCache->getContent(newIdentity, deviceFile);
-            m_identity = newIdentity;
+            Solid::OpticalDisc::ContentTypes probed;
+            if (findCachedContent(m_device->udi(), newIdentity, &probed)) {
+                m_cachedContent = probed;
+                m_identity = newIdentity;
+            } else {
+                // don't block on the drive, a propertyChanged() on AvailableContent tells when it's known
+                probeContent(m_device->udi(), m_device->prop("Device").toByteArray(), newIdentity);
+                return content | (hasAudio ? Solid::OpticalDisc::Audio : Solid::OpticalDisc::NoContent);
+            }
         }
 
         content |= m_cachedContent;
@@ -53,6 +53,13 @@ public:
     Solid::OpticalDisc::DiscType discType() const Q_DECL_OVERRIDE;
     Solid::OpticalDisc::ContentTypes availableContent() const Q_DECL_OVERRIDE;
 
+    /**
+     * Starts probing the content of the disc in @p udi on a worker thread, unless it
+     * is known already. Called when media gets inserted, so that the content is
+     * usually known before anyone asks for it.
+     */
+    static void probeContent(const QString &udi);
+
     class Identity
     {
     public:
@@ -60,21 +67,38 @@ public:
         Identity(const Device &device, const Device &drive);
         bool operator ==(const Identity &) const;
 
+        long long size() const;
+        uint labelHash() const;
+        uint uuidHash() const;
+
     private:
         long long m_detectTime;
         long long m_size;
         uint m_labelHash;
+        uint m_uuidHash;
     };
 
+    /**
+     * How the caches of probed disc contents are used, for this process.
+     */
+    struct CacheStatistics {
+        qint64 semaphoreAcquisitions;  // of the session-wide shared memory cache
+        qint64 semaphoreContended;     // acquisitions that had to wait
+        qint64 semaphoreWaitNsecs;
+        qint64 persistentHits;         // answered from disk, neither semaphore nor drive touched
+        qint64 persistentMisses;
+        qint64 persistentLockWaits;    // writes that found the file lock taken
+    };
+
+    static CacheStatistics cacheStatistics();
+
 private:
+    static bool probeContent(const QString &udi, const QByteArray &deviceFile, const Identity &identity);
 
     mutable Identity m_identity;
     QString media() const;
     mutable Solid::OpticalDisc::ContentTypes m_cachedContent;
     Device *m_drive;
-#if UDEV_FOUND
-    UdevQt::Device m_udevDevice;
-#endif
 };
 
 }
@@ -289,6 +289,14 @@ QString StorageAccess::generateReturnObjectPath()
 
 QString StorageAccess::clearTextPath() const
 {
+    // known from the container itself (udisks >= 2.7) or learnt by the manager from the cleartext device
+    const QString linked = m_device->cleartextPath();
+    if (!linked.isEmpty() && linked != "/") {
+        return linked;
+    } else if (m_device->propertyExists("CleartextDevice")) {
+        return QString(); // locked
+    }
+
     const QString prefix = "/org/freedesktop/UDisks2/block_devices";
     QDBusMessage call = QDBusMessage::createMethodCall(UD2_DBUS_SERVICE, prefix,
                         DBUS_INTERFACE_INTROSPECT, "Introspect");
@@ -22,6 +22,9 @@
 #include "udisksstoragedrive.h"
 
 #include "../shared/udevqt.h"
+#if UDEV_FOUND
+#include "../shared/pcielink.h"
+#endif
 
 #include <QtCore/QDebug>
 #include <QtCore/QFile>
@@ -30,17 +33,25 @@ using namespace Solid::Backends::UDisks2;
 
 StorageDrive::StorageDrive(Device *dev)
     : Block(dev)
+    , m_pcieLink(nullptr)
+{
+}
+
+StorageDrive::~StorageDrive()
 {
 #if UDEV_FOUND
-    UdevQt::Client client(this);
-    m_udevDevice = client.deviceByDeviceFile(device());
-    m_udevDevice.deviceProperties();
+    delete m_pcieLink;
 #endif
 }
 
-StorageDrive::~StorageDrive()
+#if UDEV_FOUND
+// looked up at each use: cached handles belong to the thread that asked for
+// them, and the monitors keep the cached properties current
+UdevQt::Device StorageDrive::udevDevice() const
 {
+    return UdevQt::DeviceCache::deviceByDeviceFile(device());
 }
+#endif
 
 qulonglong StorageDrive::size() const
 {
@@ -51,8 +62,9 @@ bool StorageDrive::isHotpluggable() const
 {
     const Solid::StorageDrive::Bus _bus = bus();
 #if UDEV_FOUND
+    const QVariant system = udevDevice().deviceProperty("UDISKS_SYSTEM");
     return _bus == Solid::StorageDrive::Usb || _bus == Solid::StorageDrive::Ieee1394 ||
-           (m_udevDevice.deviceProperty("UDISKS_SYSTEM").isValid() && !m_udevDevice.deviceProperty("UDISKS_SYSTEM").toBool());
+           (system.isValid() && !system.toBool());
 #elif defined(Q_OS_FREEBSD)
     return m_device->prop("bsdisks_IsHotpluggable").toBool();
 #else
@@ -102,9 +114,12 @@ Solid::StorageDrive::DriveType StorageDrive::driveType() const
 Solid::StorageDrive::Bus StorageDrive::bus() const
 {
     const QString bus = m_device->prop("ConnectionBus").toString();
+#if UDEV_FOUND
+    const UdevQt::Device udevDev = udevDevice();
+#endif
     const QString udevBus = 
 #if UDEV_FOUND
-        m_udevDevice.deviceProperty("ID_BUS").toString();
+        udevDev.deviceProperty("ID_BUS").toString();
 #elif defined(Q_OS_FREEBSD)
         m_device->prop("bsdisks_ConnectionBus").toString();
 #else
@@ -115,7 +130,7 @@ Solid::StorageDrive::Bus StorageDrive::bus() const
 
     if (udevBus == "ata") {
 #if UDEV_FOUND
-        if (m_udevDevice.deviceProperty("ID_ATA_SATA").toInt() == 1) { // serial ATA
+        if (udevDev.deviceProperty("ID_ATA_SATA").toInt() == 1) { // serial ATA
             return Solid::StorageDrive::Sata;
         } else { // parallel (classical) ATA
             return Solid::StorageDrive::Ide;
@@ -147,3 +162,52 @@ Solid::StorageDrive::Bus StorageDrive::bus() const
         return Solid::StorageDrive::Platform;
     }
 }
+
+// UDisks2 doesn't know about PCI Express links, read them from sysfs like
+// the udev backend does for network interfaces
+
+Solid::Backends::Shared::PcieLink *StorageDrive::pcieLink() const
+{
+#if UDEV_FOUND
+    if (!m_pcieLink) {
+        m_pcieLink = new Shared::PcieLink(QString::fromLatin1("/sys/dev/block/%1:%2").arg(deviceMajor()).arg(deviceMinor()));
+    }
+#endif
+    return m_pcieLink;
+}
+
+double StorageDrive::pcieLinkSpeed() const
+{
+#if UDEV_FOUND
+    return pcieLink()->speed();
+#else
+    return 0;
+#endif
+}
+
+int StorageDrive::pcieLinkWidth() const
+{
+#if UDEV_FOUND
+    return pcieLink()->width();
+#else
+    return 0;
+#endif
+}
+
+double StorageDrive::maxPcieLinkSpeed() const
+{
+#if UDEV_FOUND
+    return pcieLink()->maxSpeed();
+#else
+    return 0;
+#endif
+}
+
+int StorageDrive::maxPcieLinkWidth() const
+{
+#if UDEV_FOUND
+    return pcieLink()->maxWidth();
+#else
+    return 0;
+#endif
+}
@@ -33,6 +33,11 @@ namespace Solid
 {
 namespace Backends
 {
+namespace Shared
+{
+class PcieLink;
+}
+
 namespace UDisks2
 {
 
@@ -50,11 +55,17 @@ public:
     bool isRemovable() const Q_DECL_OVERRIDE;
     Solid::StorageDrive::DriveType driveType() const Q_DECL_OVERRIDE;
     Solid::StorageDrive::Bus bus() const Q_DECL_OVERRIDE;
+    double pcieLinkSpeed() const Q_DECL_OVERRIDE;
+    int pcieLinkWidth() const Q_DECL_OVERRIDE;
+    double maxPcieLinkSpeed() const Q_DECL_OVERRIDE;
+    int maxPcieLinkWidth() const Q_DECL_OVERRIDE;
 
 private:
 #if UDEV_FOUND
-    UdevQt::Device m_udevDevice;
+    UdevQt::Device udevDevice() const;
 #endif
+    Shared::PcieLink *pcieLink() const;
+    mutable Shared::PcieLink *m_pcieLink;
 };
 
 }
@@ -89,6 +89,21 @@ public:
         case Solid::DeviceInterface::NetworkShare:
             // Doesn't exist with UPower
             break;
+        case Solid::DeviceInterface::NetworkInterface:
+            // Doesn't exist with UPower
+            break;
+        case Solid::DeviceInterface::Sensor:
+            // Doesn't exist with UPower
+            break;
+        case Solid::DeviceInterface::NumaNode:
+            // Doesn't exist with UPower
+            break;
+        case Solid::DeviceInterface::EnergyCounter:
+            // Doesn't exist with UPower
+            break;
+        case Solid::DeviceInterface::Pressure:
+            // Doesn't exist with UPower
+            break;
         case Solid::DeviceInterface::Unknown:
             break;
         case Solid::DeviceInterface::Last:
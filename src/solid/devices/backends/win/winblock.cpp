@@ -71,6 +71,78 @@ QString WinBlock::device() const
     return driveLetterFromUdi(m_device->udi());
 }
 
+Solid::Block::IoStatistics WinBlock::ioStatistics() const
+{
+    //TODO:implement
+    return Solid::Block::IoStatistics();
+}
+
+bool WinBlock::isRotational() const
+{
+    //TODO:implement
+    return false;
+}
+
+int WinBlock::logicalBlockSize() const
+{
+    //TODO:implement
+    return 0;
+}
+
+int WinBlock::physicalBlockSize() const
+{
+    //TODO:implement
+    return 0;
+}
+
+int WinBlock::minimumIoSize() const
+{
+    //TODO:implement
+    return 0;
+}
+
+int WinBlock::optimalIoSize() const
+{
+    //TODO:implement
+    return 0;
+}
+
+int WinBlock::discardGranularity() const
+{
+    //TODO:implement
+    return 0;
+}
+
+Solid::Block::ZonedModel WinBlock::zonedModel() const
+{
+    //TODO:implement
+    return Solid::Block::NotZoned;
+}
+
+QString WinBlock::scheduler() const
+{
+    //TODO:implement
+    return QString();
+}
+
+int WinBlock::requestQueueSize() const
+{
+    //TODO:implement
+    return 0;
+}
+
+int WinBlock::readAheadSize() const
+{
+    //TODO:implement
+    return 0;
+}
+
+int WinBlock::hardwareQueueCount() const
+{
+    //TODO:implement
+    return 0;
+}
+
 QStringList WinBlock::drivesFromMask(const DWORD unitmask)
 {
     QStringList result;
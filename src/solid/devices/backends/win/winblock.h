@@ -45,6 +45,20 @@ public:
 
     virtual QString device() const;
 
+    virtual Solid::Block::IoStatistics ioStatistics() const;
+
+    virtual bool isRotational() const;
+    virtual int logicalBlockSize() const;
+    virtual int physicalBlockSize() const;
+    virtual int minimumIoSize() const;
+    virtual int optimalIoSize() const;
+    virtual int discardGranularity() const;
+    virtual Solid::Block::ZonedModel zonedModel() const;
+    virtual QString scheduler() const;
+    virtual int requestQueueSize() const;
+    virtual int readAheadSize() const;
+    virtual int hardwareQueueCount() const;
+
     static QSet<QString> getUdis();
 
     static QString driveLetterFromUdi(const QString &udi);
@@ -61,6 +61,89 @@ Solid::Processor::InstructionSets WinProcessor::instructionSets() const
     return set;
 }
 
+int WinProcessor::packageId() const
+{
+    //TODO:implement
+    return -1;
+}
+
+int WinProcessor::dieId() const
+{
+    //TODO:implement
+    return -1;
+}
+
+int WinProcessor::coreId() const
+{
+    return updateCache()[m_number].id;
+}
+
+int WinProcessor::threadId() const
+{
+    //TODO:implement
+    return -1;
+}
+
+int WinProcessor::numaNode() const
+{
+    //TODO:implement
+    return -1;
+}
+
+QString WinProcessor::threadSiblings() const
+{
+    //TODO:implement
+    return QString();
+}
+
+QString WinProcessor::packageSiblings() const
+{
+    //TODO:implement
+    return QString();
+}
+
+Solid::Processor::CacheList WinProcessor::caches() const
+{
+    //TODO:implement
+    return Solid::Processor::CacheList();
+}
+
+int WinProcessor::currentSpeed() const
+{
+    //TODO:implement
+    return 0;
+}
+
+QString WinProcessor::governor() const
+{
+    //TODO:implement
+    return QString();
+}
+
+QString WinProcessor::energyPerformancePreference() const
+{
+    //TODO:implement
+    return QString();
+}
+
+Solid::Processor::IdleStateList WinProcessor::idleStates() const
+{
+    //TODO:implement
+    return Solid::Processor::IdleStateList();
+}
+
+qlonglong WinProcessor::coreThrottleCount() const
+{
+    //TODO:implement
+    return -1;
+}
+
+qlonglong WinProcessor::packageThrottleCount() const
+{
+    //TODO:implement
+    return -1;
+}
+
 QSet<QString> WinProcessor::getUdis()
 {
     static QSet<QString> out;
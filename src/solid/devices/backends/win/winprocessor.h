@@ -47,6 +47,21 @@ public:
 
     virtual Solid::Processor::InstructionSets instructionSets() const;
 
+    virtual int packageId() const;
+    virtual int dieId() const;
+    virtual int coreId() const;
+    virtual int threadId() const;
+    virtual int numaNode() const;
+    virtual QString threadSiblings() const;
+    virtual QString packageSiblings() const;
+    virtual Solid::Processor::CacheList caches() const;
+    virtual int currentSpeed() const;
+    virtual QString governor() const;
+    virtual QString energyPerformancePreference() const;
+    virtual Solid::Processor::IdleStateList idleStates() const;
+    virtual qlonglong coreThrottleCount() const;
+    virtual qlonglong packageThrottleCount() const;
+
     static QSet<QString> getUdis();
 
 private:
@@ -69,6 +69,30 @@ qulonglong WinStorageDrive::size() const
     return m_size;
 }
 
+double WinStorageDrive::pcieLinkSpeed() const
+{
+    //TODO:implement
+    return 0;
+}
+
+int WinStorageDrive::pcieLinkWidth() const
+{
+    //TODO:implement
+    return 0;
+}
+
+double WinStorageDrive::maxPcieLinkSpeed() const
+{
+    //TODO:implement
+    return 0;
+}
+
+int WinStorageDrive::maxPcieLinkWidth() const
+{
+    //TODO:implement
+    return 0;
+}
+
 void WinStorageDrive::updateCache()
 {
     STORAGE_PROPERTY_QUERY storageProperty;
@@ -49,6 +49,10 @@ public:
     virtual bool isHotpluggable() const;
 
     virtual qulonglong size() const;
+    virtual double pcieLinkSpeed() const;
+    virtual int pcieLinkWidth() const;
+    virtual double maxPcieLinkSpeed() const;
+    virtual int maxPcieLinkWidth() const;
 
 private:
     void updateCache();
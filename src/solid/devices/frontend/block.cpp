@@ -52,3 +52,75 @@ QString Solid::Block::device() const
     return_SOLID_CALL(Ifaces::Block *, d->backendObject(), QString(), device());
 }
 
+Solid::Block::IoStatistics Solid::Block::ioStatistics() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), IoStatistics(), ioStatistics());
+}
+
+bool Solid::Block::isRotational() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), false, isRotational());
+}
+
+int Solid::Block::logicalBlockSize() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), 0, logicalBlockSize());
+}
+
+int Solid::Block::physicalBlockSize() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), 0, physicalBlockSize());
+}
+
+int Solid::Block::minimumIoSize() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), 0, minimumIoSize());
+}
+
+int Solid::Block::optimalIoSize() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), 0, optimalIoSize());
+}
+
+int Solid::Block::discardGranularity() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), 0, discardGranularity());
+}
+
+Solid::Block::ZonedModel Solid::Block::zonedModel() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), NotZoned, zonedModel());
+}
+
+QString Solid::Block::scheduler() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), QString(), scheduler());
+}
+
+int Solid::Block::requestQueueSize() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), 0, requestQueueSize());
+}
+
+int Solid::Block::readAheadSize() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), 0, readAheadSize());
+}
+
+int Solid::Block::hardwareQueueCount() const
+{
+    Q_D(const Block);
+    return_SOLID_CALL(Ifaces::Block *, d->backendObject(), 0, hardwareQueueCount());
+}
+
@@ -43,6 +43,17 @@ class SOLID_EXPORT Block : public DeviceInterface
     Q_PROPERTY(int major READ deviceMajor)
     Q_PROPERTY(int minor READ deviceMinor)
     Q_PROPERTY(QString device READ device)
+    Q_PROPERTY(bool rotational READ isRotational)
+    Q_PROPERTY(int logicalBlockSize READ logicalBlockSize)
+    Q_PROPERTY(int physicalBlockSize READ physicalBlockSize)
+    Q_PROPERTY(int minimumIoSize READ minimumIoSize)
+    Q_PROPERTY(int optimalIoSize READ optimalIoSize)
+    Q_PROPERTY(int discardGranularity READ discardGranularity)
+    Q_PROPERTY(ZonedModel zonedModel READ zonedModel)
+    Q_PROPERTY(QString scheduler READ scheduler)
+    Q_PROPERTY(int requestQueueSize READ requestQueueSize)
+    Q_PROPERTY(int readAheadSize READ readAheadSize)
+    Q_PROPERTY(int hardwareQueueCount READ hardwareQueueCount)
     Q_DECLARE_PRIVATE(Block)
     friend class Device;
 
@@ -58,6 +69,61 @@ private:
     explicit Block(QObject *backendObject);
 
 public:
+    /**
+     * This enum type defines how a zoned device constrains writes.
+     *
+     * - NotZoned : a regular device, or one emulating random writes
+     * - HostAware : sequential writes are preferred within zones, random
+     *   writes are still accepted
+     * - HostManaged : zones must be written sequentially
+     *
+     * @since 5.37
+     */
+    enum ZonedModel { NotZoned, HostAware, HostManaged };
+    Q_ENUM(ZonedModel)
+
+    /**
+     * The I/O counters the kernel keeps for a block device since it
+     * appeared. Times are in milliseconds, sectors are always 512 bytes
+     * regardless of the device's block size.
+     *
+     * @since 5.37
+     */
+    struct IoStatistics {
+        IoStatistics()
+            : valid(false), readsCompleted(0), readsMerged(0), sectorsRead(0), readTime(0),
+              writesCompleted(0), writesMerged(0), sectorsWritten(0), writeTime(0),
+              inFlight(0), ioTime(0), timeInQueue(0),
+              discardsCompleted(0), discardsMerged(0), sectorsDiscarded(0), discardTime(0),
+              flushesCompleted(0), flushTime(0), readsInFlight(0), writesInFlight(0) {}
+
+        /// false if the backend has no statistics for the device
+        bool valid;
+        qulonglong readsCompleted;
+        qulonglong readsMerged;
+        qulonglong sectorsRead;
+        qulonglong readTime;
+        qulonglong writesCompleted;
+        qulonglong writesMerged;
+        qulonglong sectorsWritten;
+        qulonglong writeTime;
+        /// the requests currently issued to the driver
+        qulonglong inFlight;
+        /// the time the device had requests in flight
+        qulonglong ioTime;
+        /// the time all requests spent in flight, weighted by their number
+        qulonglong timeInQueue;
+        /// discard and flush counters are 0 on kernels not providing them
+        qulonglong discardsCompleted;
+        qulonglong discardsMerged;
+        qulonglong sectorsDiscarded;
+        qulonglong discardTime;
+        qulonglong flushesCompleted;
+        qulonglong flushTime;
+        qulonglong readsInFlight;
+        qulonglong writesInFlight;
+    };
+
     /**
      * Destroys a Block object.
      */
@@ -98,6 +164,113 @@ public:
      * the device
      */
     QString device() const;
+
+    /**
+     * Retrieves the I/O counters of the device. Backends keep the
+     * underlying files open, so this is cheap enough to be polled; use
+     * Solid::BlockIoSampler to turn the counters into rates.
+     *
+     * @return the current I/O counters
+     * @since 5.37
+     */
+    IoStatistics ioStatistics() const;
+
+    /**
+     * Indicates if the device has rotating media, where seeking is
+     * expensive. Partitions report the value of their disk.
+     *
+     * @return true if the device is rotational, false for solid state
+     * devices or if unknown
+     * @since 5.37
+     */
+    bool isRotational() const;
+
+    /**
+     * Retrieves the smallest unit the device can address.
+     *
+     * @return the logical block size in bytes, 0 if unknown
+     * @since 5.37
+     */
+    int logicalBlockSize() const;
+
+    /**
+     * Retrieves the smallest unit the device can write without a
+     * read-modify-write cycle.
+     *
+     * @return the physical block size in bytes, 0 if unknown
+     * @since 5.37
+     */
+    int physicalBlockSize() const;
+
+    /**
+     * Retrieves the preferred minimum request size, e.g. the chunk size of
+     * a RAID device.
+     *
+     * @return the minimum I/O size in bytes, 0 if unknown
+     * @since 5.37
+     */
+    int minimumIoSize() const;
+
+    /**
+     * Retrieves the preferred size for sustained I/O, e.g. the stripe
+     * width of a RAID device.
+     *
+     * @return the optimal I/O size in bytes, 0 if the device doesn't
+     * report one
+     * @since 5.37
+     */
+    int optimalIoSize() const;
+
+    /**
+     * Retrieves the granularity at which the device discards blocks.
+     *
+     * @return the discard granularity in bytes, 0 if the device doesn't
+     * support discarding
+     * @since 5.37
+     */
+    int discardGranularity() const;
+
+    /**
+     * Retrieves the zoned block device model.
+     *
+     * @return the zoned model
+     * @since 5.37
+     */
+    ZonedModel zonedModel() const;
+
+    /**
+     * Retrieves the active I/O scheduler.
+     *
+     * @return the name of the scheduler, e.g. "mq-deadline" or "none",
+     * or an empty string if unknown
+     * @since 5.37
+     */
+    QString scheduler() const;
+
+    /**
+     * Retrieves how many requests the block layer queues for the device.
+     *
+     * @return the request queue size, 0 if unknown
+     * @since 5.37
+     */
+    int requestQueueSize() const;
+
+    /**
+     * Retrieves the read-ahead window.
+     *
+     * @return the read-ahead size in KiB, 0 if unknown
+     * @since 5.37
+     */
+    int readAheadSize() const;
+
+    /**
+     * Retrieves the number of hardware queues of a multi-queue device, such
+     * as the submission queues of an NVMe drive.
+     *
+     * @return the number of hardware queues, 0 if unknown
+     * @since 5.37
+     */
+    int hardwareQueueCount() const;
 };
 }
 
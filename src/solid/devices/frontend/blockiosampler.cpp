@@ -0,0 +1,144 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "blockiosampler.h"
+#include "sampler_p.h"
+
+namespace Solid
+{
+class BlockIoSamplerPrivate : public SamplerPrivate
+{
+public:
+    BlockIoSamplerPrivate(BlockIoSampler *q, const QList<Device> &devices)
+        : SamplerPrivate(q, SLOT(collect()), devices, DeviceInterface::Block, 1000)
+    {
+    }
+
+    SampleHistory<Block::IoStatistics> history;
+};
+}
+
+Solid::BlockIoSampler::BlockIoSampler(QObject *parent)
+    : QObject(parent),
+      d(new BlockIoSamplerPrivate(this, Device::listFromType(DeviceInterface::Block)))
+{
+    qRegisterMetaType<Solid::BlockIoSampler::SampleList>();
+}
+
+Solid::BlockIoSampler::BlockIoSampler(const QList<Device> &devices, QObject *parent)
+    : QObject(parent),
+      d(new BlockIoSamplerPrivate(this, devices))
+{
+    qRegisterMetaType<Solid::BlockIoSampler::SampleList>();
+}
+
+Solid::BlockIoSampler::~BlockIoSampler()
+{
+    delete d;
+}
+
+int Solid::BlockIoSampler::interval() const
+{
+    return d->interval();
+}
+
+void Solid::BlockIoSampler::setInterval(int msec)
+{
+    d->setInterval(msec);
+}
+
+bool Solid::BlockIoSampler::isActive() const
+{
+    return d->isActive();
+}
+
+void Solid::BlockIoSampler::start()
+{
+    d->start();
+}
+
+void Solid::BlockIoSampler::stop()
+{
+    d->stop();
+}
+
+Solid::BlockIoSampler::SampleList Solid::BlockIoSampler::sample()
+{
+    SampleList samples;
+    samples.reserve(d->devices.size());
+
+    Q_FOREACH (const Device &device, d->devices) {
+        const Block *block = device.as<Block>();
+        if (!block) {
+            continue;
+        }
+
+        Sample sample;
+        sample.udi = device.udi();
+        sample.device = block->device();
+        sample.statistics = block->ioStatistics();
+        // one timestamp per device keeps the intervals exact when reading
+        // many devices takes a while
+        const qint64 now = d->clock.nsecsElapsed();
+
+        if (!sample.statistics.valid) {
+            d->history.forget(sample.udi);
+            samples << sample;
+            continue;
+        }
+
+        const Block::IoStatistics &current = sample.statistics;
+        Block::IoStatistics before;
+        qint64 elapsedNsecs;
+        if (d->history.advance(sample.udi, current, now, &before, &elapsedNsecs)) {
+            sample.interval = elapsedNsecs / 1000000;
+            sample.reads = counterDelta(current.readsCompleted, before.readsCompleted);
+            sample.writes = counterDelta(current.writesCompleted, before.writesCompleted);
+            sample.bytesRead = counterDelta(current.sectorsRead, before.sectorsRead) * 512;
+            sample.bytesWritten = counterDelta(current.sectorsWritten, before.sectorsWritten) * 512;
+
+            if (elapsedNsecs > 0) {
+                const double seconds = elapsedNsecs / 1e9;
+                const double msecs = elapsedNsecs / 1e6;
+                sample.readsPerSecond = sample.reads / seconds;
+                sample.writesPerSecond = sample.writes / seconds;
+                sample.readBytesPerSecond = sample.bytesRead / seconds;
+                sample.writeBytesPerSecond = sample.bytesWritten / seconds;
+                sample.utilization = qMin(1.0, counterDelta(current.ioTime, before.ioTime) / msecs);
+                sample.averageQueueDepth = counterDelta(current.timeInQueue, before.timeInQueue) / msecs;
+            }
+            if (sample.reads > 0) {
+                sample.averageReadLatency = double(counterDelta(current.readTime, before.readTime)) / sample.reads;
+            }
+            if (sample.writes > 0) {
+                sample.averageWriteLatency = double(counterDelta(current.writeTime, before.writeTime)) / sample.writes;
+            }
+        }
+
+        samples << sample;
+    }
+
+    return samples;
+}
+
+void Solid::BlockIoSampler::collect()
+{
+    emit sampled(sample());
+}
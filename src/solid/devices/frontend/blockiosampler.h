@@ -0,0 +1,140 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_BLOCKIOSAMPLER_H
+#define SOLID_BLOCKIOSAMPLER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+
+#include <solid/solid_export.h>
+
+#include <solid/device.h>
+#include <solid/block.h>
+
+namespace Solid
+{
+class BlockIoSamplerPrivate;
+
+/**
+ * Periodically samples the I/O counters of a set of block devices and turns
+ * them into rates: operations and bytes per second, utilisation, average
+ * latencies and queue depth over the last interval.
+ *
+ * All devices are read in one go on every tick and reported through a single
+ * sampled() signal. Backends keep the counter files open between samples, so
+ * a tick costs about two reads per device.
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT BlockIoSampler : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int interval READ interval WRITE setInterval)
+    Q_PROPERTY(bool active READ isActive)
+
+public:
+    /**
+     * The I/O activity of one block device over the last interval.
+     */
+    struct Sample {
+        Sample()
+            : interval(0), reads(0), writes(0), bytesRead(0), bytesWritten(0),
+              readsPerSecond(0), writesPerSecond(0), readBytesPerSecond(0), writeBytesPerSecond(0),
+              utilization(0), averageReadLatency(0), averageWriteLatency(0), averageQueueDepth(0) {}
+
+        QString udi;
+        QString device;
+        /// the counters at the time of the sample
+        Block::IoStatistics statistics;
+        /// milliseconds since the previous sample, 0 for the first one, in
+        /// which case all deltas and rates are 0 as well
+        qint64 interval;
+        /// completed operations and transferred bytes during the interval
+        qulonglong reads;
+        qulonglong writes;
+        qulonglong bytesRead;
+        qulonglong bytesWritten;
+        double readsPerSecond;
+        double writesPerSecond;
+        double readBytesPerSecond;
+        double writeBytesPerSecond;
+        /// the fraction of the interval the device was busy, between 0 and 1
+        double utilization;
+        /// the average time in milliseconds a request completed during the
+        /// interval took, 0 if there was none
+        double averageReadLatency;
+        double averageWriteLatency;
+        /// the average number of requests in flight
+        double averageQueueDepth;
+    };
+    typedef QList<Sample> SampleList;
+
+    /**
+     * Creates a sampler for all block devices of the system.
+     */
+    explicit BlockIoSampler(QObject *parent = nullptr);
+
+    /**
+     * Creates a sampler for the given devices. Devices not providing the
+     * Block interface are ignored.
+     */
+    explicit BlockIoSampler(const QList<Device> &devices, QObject *parent = nullptr);
+
+    ~BlockIoSampler();
+
+    /**
+     * @return the sampling interval in milliseconds, 1000 by default
+     */
+    int interval() const;
+    void setInterval(int msec);
+
+    bool isActive() const;
+
+    /**
+     * Takes a sample of all devices right away, without emitting sampled().
+     * The deltas are relative to the previous sample, whether it was taken
+     * by the timer or by calling this method.
+     */
+    SampleList sample();
+
+public Q_SLOTS:
+    void start();
+    void stop();
+
+Q_SIGNALS:
+    /**
+     * Emitted once per interval with a sample of every device.
+     */
+    void sampled(const Solid::BlockIoSampler::SampleList &samples);
+
+private Q_SLOTS:
+    void collect();
+
+private:
+    BlockIoSamplerPrivate *const d;
+};
+}
+
+Q_DECLARE_METATYPE(Solid::BlockIoSampler::Sample)
+Q_DECLARE_METATYPE(Solid::BlockIoSampler::SampleList)
+
+#endif
@@ -50,6 +50,16 @@
 #include <solid/devices/ifaces/portablemediaplayer.h>
 #include <solid/networkshare.h>
 #include <solid/devices/ifaces/networkshare.h>
+#include <solid/networkinterface.h>
+#include <solid/devices/ifaces/networkinterface.h>
+#include <solid/sensor.h>
+#include <solid/devices/ifaces/sensor.h>
+#include <solid/numanode.h>
+#include <solid/devices/ifaces/numanode.h>
+#include <solid/energycounter.h>
+#include <solid/devices/ifaces/energycounter.h>
+#include <solid/pressure.h>
+#include <solid/devices/ifaces/pressure.h>
 #include <solid/battery.h>
 #include <solid/devices/ifaces/battery.h>
 
@@ -191,6 +201,21 @@ const Solid::DeviceInterface *Solid::Device::asDeviceInterface(const DeviceInter
             case DeviceInterface::NetworkShare:
                 iface = deviceinterface_cast(Ifaces::NetworkShare, NetworkShare, dev_iface);
                 break;
+            case DeviceInterface::NetworkInterface:
+                iface = deviceinterface_cast(Ifaces::NetworkInterface, NetworkInterface, dev_iface);
+                break;
+            case DeviceInterface::Sensor:
+                iface = deviceinterface_cast(Ifaces::Sensor, Sensor, dev_iface);
+                break;
+            case DeviceInterface::NumaNode:
+                iface = deviceinterface_cast(Ifaces::NumaNode, NumaNode, dev_iface);
+                break;
+            case DeviceInterface::EnergyCounter:
+                iface = deviceinterface_cast(Ifaces::EnergyCounter, EnergyCounter, dev_iface);
+                break;
+            case DeviceInterface::Pressure:
+                iface = deviceinterface_cast(Ifaces::Pressure, Pressure, dev_iface);
+                break;
             case DeviceInterface::Unknown:
             case DeviceInterface::Last:
                 break;
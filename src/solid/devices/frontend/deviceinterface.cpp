@@ -88,6 +88,16 @@ QString Solid::DeviceInterface::typeDescription(Type type)
         return tr("Battery", "Battery device type");
     case NetworkShare:
         return tr("Network Share", "Network Share device type");
+    case NetworkInterface:
+        return tr("Network Interface", "Network Interface device type");
+    case Sensor:
+        return tr("Sensor", "Sensor device type");
+    case NumaNode:
+        return tr("NUMA Node", "NUMA Node device type");
+    case EnergyCounter:
+        return tr("Energy Counter", "Energy Counter device type");
+    case Pressure:
+        return tr("Pressure", "Pressure device type");
     case Last:
         return QString();
     }
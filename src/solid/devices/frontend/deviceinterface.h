@@ -58,12 +58,18 @@ public:
      * - Camera : A digital camera
      * - PortableMediaPlayer: A portable media player
      * - NetworkShare: A network share interface
+     * - NetworkInterface: A network interface (since 5.37)
+     * - Sensor: A hardware monitoring chip or thermal zone (since 5.37)
+     * - NumaNode: A NUMA memory node (since 5.37)
+     * - EnergyCounter: The energy counter of a power capping zone (since 5.37)
+     * - Pressure: The pressure stall information of a resource (since 5.37)
      */
     enum Type { Unknown = 0, GenericInterface = 1, Processor = 2,
                 Block = 3, StorageAccess = 4, StorageDrive = 5,
                 OpticalDrive = 6, StorageVolume = 7, OpticalDisc = 8,
                 Camera = 9, PortableMediaPlayer = 10,
-                Battery = 12, NetworkShare = 14, Last = 0xffff
+                NetworkInterface = 11, Battery = 12, Sensor = 13, NetworkShare = 14,
+                NumaNode = 15, EnergyCounter = 16, Pressure = 17, Last = 0xffff
               };
     Q_ENUM(Type)
 
@@ -0,0 +1,65 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "energycounter.h"
+#include "energycounter_p.h"
+
+#include "soliddefs_p.h"
+#include <solid/devices/ifaces/energycounter.h>
+
+Solid::EnergyCounter::EnergyCounter(QObject *backendObject)
+    : DeviceInterface(*new EnergyCounterPrivate(), backendObject)
+{
+}
+
+Solid::EnergyCounter::~EnergyCounter()
+{
+
+}
+
+QString Solid::EnergyCounter::name() const
+{
+    Q_D(const EnergyCounter);
+    return_SOLID_CALL(Ifaces::EnergyCounter *, d->backendObject(), QString(), name());
+}
+
+Solid::EnergyCounter::Domain Solid::EnergyCounter::domain() const
+{
+    Q_D(const EnergyCounter);
+    return_SOLID_CALL(Ifaces::EnergyCounter *, d->backendObject(), UnknownDomain, domain());
+}
+
+qulonglong Solid::EnergyCounter::maxEnergyRange() const
+{
+    Q_D(const EnergyCounter);
+    return_SOLID_CALL(Ifaces::EnergyCounter *, d->backendObject(), 0, maxEnergyRange());
+}
+
+qulonglong Solid::EnergyCounter::energy() const
+{
+    Q_D(const EnergyCounter);
+    return_SOLID_CALL(Ifaces::EnergyCounter *, d->backendObject(), 0, energy());
+}
+
+bool Solid::EnergyCounter::isReadable() const
+{
+    Q_D(const EnergyCounter);
+    return_SOLID_CALL(Ifaces::EnergyCounter *, d->backendObject(), false, isReadable());
+}
@@ -0,0 +1,136 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_ENERGYCOUNTER_H
+#define SOLID_ENERGYCOUNTER_H
+
+#include <solid/solid_export.h>
+
+#include <solid/deviceinterface.h>
+
+namespace Solid
+{
+class EnergyCounterPrivate;
+class Device;
+
+/**
+ * This device interface is available on the energy counters of power
+ * capping zones, such as the RAPL domains of x86 processors. Unlike
+ * Solid::Battery it works on mains powered systems, and measures the energy
+ * of a part of the system rather than of the whole.
+ *
+ * Use Solid::EnergyMeter to measure the energy of a workload.
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT EnergyCounter : public DeviceInterface
+{
+    Q_OBJECT
+    Q_PROPERTY(QString name READ name)
+    Q_PROPERTY(Domain domain READ domain)
+    Q_PROPERTY(qulonglong maxEnergyRange READ maxEnergyRange)
+    Q_DECLARE_PRIVATE(EnergyCounter)
+    friend class Device;
+
+public:
+    /**
+     * This enum type defines the part of the system a counter measures.
+     *
+     * - UnknownDomain : the domain isn't known to Solid
+     * - Package : a whole processor package
+     * - Core : the cores of a package
+     * - Uncore : the rest of a package, usually the integrated graphics
+     * - Dram : the memory attached to a package
+     * - Platform : the whole platform, as far as the firmware can tell
+     */
+    enum Domain { UnknownDomain, Package, Core, Uncore, Dram, Platform };
+    Q_ENUM(Domain)
+
+private:
+    /**
+     * Creates a new EnergyCounter object.
+     * You generally won't need this. It's created when necessary using
+     * Device::as().
+     *
+     * @param backendObject the device interface object provided by the backend
+     * @see Solid::Device::as()
+     */
+    explicit EnergyCounter(QObject *backendObject);
+
+public:
+    /**
+     * Destroys an EnergyCounter object.
+     */
+    virtual ~EnergyCounter();
+
+    /**
+     * Get the Solid::DeviceInterface::Type of the EnergyCounter device interface.
+     *
+     * @return the EnergyCounter device interface type
+     * @see Solid::Ifaces::Enums::DeviceInterface::Type
+     */
+    static Type deviceInterfaceType()
+    {
+        return DeviceInterface::EnergyCounter;
+    }
+
+    /**
+     * Retrieves the name of the counter, e.g. "package-0" or "dram".
+     *
+     * @return the counter name
+     */
+    QString name() const;
+
+    /**
+     * Retrieves the part of the system the counter measures.
+     *
+     * @return the domain
+     */
+    Domain domain() const;
+
+    /**
+     * Retrieves the value at which the hardware counter wraps around.
+     *
+     * @return the range in microjoules
+     */
+    qulonglong maxEnergyRange() const;
+
+    /**
+     * Retrieves the energy consumed so far. Wraparounds of the hardware
+     * counter are accounted for as long as the counter is read at least
+     * once per wrap period, which Solid::EnergyMeter takes care of while
+     * its event loop runs. Only differences between two readings are
+     * meaningful.
+     *
+     * @return the energy in microjoules
+     */
+    qulonglong energy() const;
+
+    /**
+     * Indicates if the counter can be read. Since Linux 5.10 the RAPL
+     * counters are only readable by root.
+     *
+     * @return true if energy() reports actual values
+     */
+    bool isReadable() const;
+};
+}
+
+#endif
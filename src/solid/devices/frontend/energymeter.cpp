@@ -0,0 +1,143 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "energymeter.h"
+#include "sampler_p.h"
+
+namespace Solid
+{
+class EnergyMeterPrivate : public SamplerPrivate
+{
+public:
+    EnergyMeterPrivate(EnergyMeter *q, const QList<Device> &devices)
+        : SamplerPrivate(q, SLOT(readCounters()), devices, DeviceInterface::EnergyCounter, 10000)
+    {
+    }
+
+    EnergyMeter::MeasurementList measure() const;
+
+    // udi -> energy at start()
+    QHash<QString, qulonglong> startEnergy;
+    EnergyMeter::MeasurementList result;
+};
+}
+
+Solid::EnergyMeter::MeasurementList Solid::EnergyMeterPrivate::measure() const
+{
+    EnergyMeter::MeasurementList measurements;
+    const double seconds = clock.nsecsElapsed() / 1e9;
+
+    Q_FOREACH (const Device &device, devices) {
+        QHash<QString, qulonglong>::const_iterator start = startEnergy.constFind(device.udi());
+        const EnergyCounter *counter = device.as<EnergyCounter>();
+        if (start == startEnergy.constEnd() || !counter) {
+            continue;
+        }
+
+        EnergyMeter::Measurement measurement;
+        measurement.udi = device.udi();
+        measurement.name = counter->name();
+        measurement.domain = counter->domain();
+        const qulonglong energy = counter->energy();
+        measurement.joules = energy >= start.value() ? (energy - start.value()) / 1e6 : 0;
+        measurement.seconds = seconds;
+        if (seconds > 0) {
+            measurement.averageWatts = measurement.joules / seconds;
+        }
+        measurements << measurement;
+    }
+    return measurements;
+}
+
+Solid::EnergyMeter::EnergyMeter(QObject *parent)
+    : QObject(parent),
+      d(new EnergyMeterPrivate(this, Device::listFromType(DeviceInterface::EnergyCounter)))
+{
+    qRegisterMetaType<Solid::EnergyMeter::MeasurementList>();
+}
+
+Solid::EnergyMeter::EnergyMeter(const QList<Device> &devices, QObject *parent)
+    : QObject(parent),
+      d(new EnergyMeterPrivate(this, devices))
+{
+    qRegisterMetaType<Solid::EnergyMeter::MeasurementList>();
+}
+
+Solid::EnergyMeter::~EnergyMeter()
+{
+    delete d;
+}
+
+int Solid::EnergyMeter::interval() const
+{
+    return d->interval();
+}
+
+void Solid::EnergyMeter::setInterval(int msec)
+{
+    d->setInterval(msec);
+}
+
+bool Solid::EnergyMeter::isActive() const
+{
+    return d->isActive();
+}
+
+void Solid::EnergyMeter::start()
+{
+    d->startEnergy.clear();
+    d->result.clear();
+
+    Q_FOREACH (const Device &device, d->devices) {
+        const EnergyCounter *counter = device.as<EnergyCounter>();
+        if (counter && counter->isReadable()) {
+            d->startEnergy.insert(device.udi(), counter->energy());
+        }
+    }
+    d->clock.start();
+    d->start();
+}
+
+Solid::EnergyMeter::MeasurementList Solid::EnergyMeter::stop()
+{
+    if (!d->isActive()) {
+        return d->result;
+    }
+
+    d->stop();
+    d->result = d->measure();
+    return d->result;
+}
+
+Solid::EnergyMeter::MeasurementList Solid::EnergyMeter::measurements() const
+{
+    return d->isActive() ? d->measure() : d->result;
+}
+
+void Solid::EnergyMeter::readCounters()
+{
+    // reading is enough, the backends fold wraparounds into the total; this
+    // only runs while the event loop does, see the class documentation
+    Q_FOREACH (const Device &device, d->devices) {
+        if (const EnergyCounter *counter = device.as<EnergyCounter>()) {
+            counter->energy();
+        }
+    }
+}
@@ -0,0 +1,143 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_ENERGYMETER_H
+#define SOLID_ENERGYMETER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+
+#include <solid/solid_export.h>
+
+#include <solid/device.h>
+#include <solid/energycounter.h>
+
+namespace Solid
+{
+class EnergyMeterPrivate;
+
+/**
+ * Measures the energy used by a set of energy counters between start() and
+ * stop(), e.g. to account the energy cost of a batch job running while the
+ * event loop keeps going:
+ *
+ * @code
+ * meter->start();
+ * connect(job, &Job::finished, [meter]() {
+ *     Q_FOREACH (const Solid::EnergyMeter::Measurement &m, meter->stop()) {
+ *         qDebug() << m.name << m.joules << "J" << m.averageWatts << "W";
+ *     }
+ * });
+ * @endcode
+ *
+ * The hardware counters wrap around every maxEnergyRange() divided by the
+ * power of the domain, which can be as little as a few minutes. A wrap is
+ * only accounted for if the counter is read at least once per wrap period.
+ * The meter reads the counters every interval() milliseconds from a timer,
+ * so the thread it lives in must run its event loop during the measurement.
+ * Code blocking that thread from start() to stop() has to call
+ * measurements() at least once per wrap period itself, as it reads the
+ * counters too; otherwise the energy of every missed wrap is lost.
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT EnergyMeter : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int interval READ interval WRITE setInterval)
+    Q_PROPERTY(bool active READ isActive)
+
+public:
+    /**
+     * The energy one counter measured.
+     */
+    struct Measurement {
+        Measurement()
+            : domain(EnergyCounter::UnknownDomain), joules(0), seconds(0), averageWatts(0) {}
+
+        QString udi;
+        QString name;
+        EnergyCounter::Domain domain;
+        double joules;
+        /// the duration of the measurement
+        double seconds;
+        double averageWatts;
+    };
+    typedef QList<Measurement> MeasurementList;
+
+    /**
+     * Creates a meter for all energy counters of the system.
+     */
+    explicit EnergyMeter(QObject *parent = nullptr);
+
+    /**
+     * Creates a meter for the given devices. Devices not providing the
+     * EnergyCounter interface are ignored.
+     */
+    explicit EnergyMeter(const QList<Device> &devices, QObject *parent = nullptr);
+
+    ~EnergyMeter();
+
+    /**
+     * @return how often the counters are read during a measurement, in
+     * milliseconds, 10000 by default; it must stay below the wrap period of
+     * the counters, and only takes effect while the event loop runs
+     */
+    int interval() const;
+    void setInterval(int msec);
+
+    /**
+     * @return true between start() and stop()
+     */
+    bool isActive() const;
+
+    /**
+     * Starts a new measurement. Counters that can't be read are left out.
+     */
+    void start();
+
+    /**
+     * Ends the measurement.
+     *
+     * @return the energy measured by every counter since start()
+     */
+    MeasurementList stop();
+
+    /**
+     * @return the energy measured so far if a measurement is running, the
+     * result of the last one otherwise. Calling it during a measurement
+     * reads the counters, which keeps wraps accounted for without an event
+     * loop.
+     */
+    MeasurementList measurements() const;
+
+private Q_SLOTS:
+    void readCounters();
+
+private:
+    EnergyMeterPrivate *const d;
+};
+}
+
+Q_DECLARE_METATYPE(Solid::EnergyMeter::Measurement)
+Q_DECLARE_METATYPE(Solid::EnergyMeter::MeasurementList)
+
+#endif
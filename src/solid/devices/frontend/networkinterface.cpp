@@ -0,0 +1,135 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "networkinterface.h"
+#include "networkinterface_p.h"
+
+#include "soliddefs_p.h"
+#include <solid/devices/ifaces/networkinterface.h>
+
+Solid::NetworkInterface::NetworkInterface(QObject *backendObject)
+    : DeviceInterface(*new NetworkInterfacePrivate(), backendObject)
+{
+}
+
+Solid::NetworkInterface::~NetworkInterface()
+{
+
+}
+
+QString Solid::NetworkInterface::interfaceName() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), QString(), interfaceName());
+}
+
+QString Solid::NetworkInterface::hardwareAddress() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), QString(), hardwareAddress());
+}
+
+bool Solid::NetworkInterface::isWireless() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), false, isWireless());
+}
+
+int Solid::NetworkInterface::speed() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), -1, speed());
+}
+
+Solid::NetworkInterface::Duplex Solid::NetworkInterface::duplex() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), UnknownDuplex, duplex());
+}
+
+int Solid::NetworkInterface::mtu() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), 0, mtu());
+}
+
+bool Solid::NetworkInterface::hasCarrier() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), false, hasCarrier());
+}
+
+Solid::NetworkInterface::OperationalState Solid::NetworkInterface::operationalState() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), UnknownState, operationalState());
+}
+
+int Solid::NetworkInterface::rxQueueCount() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), 0, rxQueueCount());
+}
+
+int Solid::NetworkInterface::txQueueCount() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), 0, txQueueCount());
+}
+
+Solid::NetworkInterface::Statistics Solid::NetworkInterface::statistics() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), Statistics(), statistics());
+}
+
+double Solid::NetworkInterface::pcieLinkSpeed() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), 0, pcieLinkSpeed());
+}
+
+int Solid::NetworkInterface::pcieLinkWidth() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), 0, pcieLinkWidth());
+}
+
+double Solid::NetworkInterface::maxPcieLinkSpeed() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), 0, maxPcieLinkSpeed());
+}
+
+int Solid::NetworkInterface::maxPcieLinkWidth() const
+{
+    Q_D(const NetworkInterface);
+    return_SOLID_CALL(Ifaces::NetworkInterface *, d->backendObject(), 0, maxPcieLinkWidth());
+}
+
+bool Solid::NetworkInterface::isPcieLinkDegraded() const
+{
+    const double speed = pcieLinkSpeed();
+    const int width = pcieLinkWidth();
+    if (speed <= 0 || width <= 0) {
+        return false;
+    }
+    return speed < maxPcieLinkSpeed() || width < maxPcieLinkWidth();
+}
@@ -0,0 +1,269 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_NETWORKINTERFACE_H
+#define SOLID_NETWORKINTERFACE_H
+
+#include <solid/solid_export.h>
+
+#include <solid/deviceinterface.h>
+
+namespace Solid
+{
+class NetworkInterfacePrivate;
+class Device;
+
+/**
+ * This device interface is available on network interfaces, physical
+ * (Ethernet, Wi-Fi) as well as virtual ones (bridges, bonds, VLANs...).
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT NetworkInterface : public DeviceInterface
+{
+    Q_OBJECT
+    Q_PROPERTY(QString interfaceName READ interfaceName)
+    Q_PROPERTY(QString hardwareAddress READ hardwareAddress)
+    Q_PROPERTY(bool wireless READ isWireless)
+    Q_PROPERTY(int speed READ speed)
+    Q_PROPERTY(Duplex duplex READ duplex)
+    Q_PROPERTY(int mtu READ mtu)
+    Q_PROPERTY(bool carrier READ hasCarrier)
+    Q_PROPERTY(OperationalState operationalState READ operationalState)
+    Q_PROPERTY(int rxQueueCount READ rxQueueCount)
+    Q_PROPERTY(int txQueueCount READ txQueueCount)
+    Q_PROPERTY(double pcieLinkSpeed READ pcieLinkSpeed)
+    Q_PROPERTY(int pcieLinkWidth READ pcieLinkWidth)
+    Q_PROPERTY(double maxPcieLinkSpeed READ maxPcieLinkSpeed)
+    Q_PROPERTY(int maxPcieLinkWidth READ maxPcieLinkWidth)
+    Q_PROPERTY(bool pcieLinkDegraded READ isPcieLinkDegraded)
+    Q_DECLARE_PRIVATE(NetworkInterface)
+    friend class Device;
+
+public:
+    /**
+     * This enum type defines the duplex mode of a link.
+     *
+     * - UnknownDuplex : the mode is unknown, e.g. because the link is down
+     * - HalfDuplex : the link can either send or receive at a time
+     * - FullDuplex : the link can send and receive at the same time
+     */
+    enum Duplex { UnknownDuplex, HalfDuplex, FullDuplex };
+    Q_ENUM(Duplex)
+
+    /**
+     * This enum type defines the operational state of an interface, as
+     * described in RFC 2863.
+     *
+     * - UnknownState : the driver doesn't report a state
+     * - NotPresent : a component of the interface is missing
+     * - Down : the interface can't pass packets
+     * - LowerLayerDown : an interface the interface builds on is down
+     * - Testing : the interface is in test mode
+     * - Dormant : the interface waits for an external event, e.g.
+     *   802.1X authentication
+     * - Up : the interface can pass packets
+     */
+    enum OperationalState { UnknownState, NotPresent, Down, LowerLayerDown, Testing, Dormant, Up };
+    Q_ENUM(OperationalState)
+
+    /**
+     * The traffic counters the kernel keeps for an interface since it
+     * appeared.
+     */
+    struct Statistics {
+        Statistics()
+            : valid(false), rxBytes(0), txBytes(0), rxPackets(0), txPackets(0),
+              rxErrors(0), txErrors(0), rxDropped(0), txDropped(0),
+              multicast(0), collisions(0) {}
+
+        /// false if the backend has no statistics for the interface
+        bool valid;
+        qulonglong rxBytes;
+        qulonglong txBytes;
+        qulonglong rxPackets;
+        qulonglong txPackets;
+        qulonglong rxErrors;
+        qulonglong txErrors;
+        qulonglong rxDropped;
+        qulonglong txDropped;
+        /// multicast packets received
+        qulonglong multicast;
+        qulonglong collisions;
+    };
+
+private:
+    /**
+     * Creates a new NetworkInterface object.
+     * You generally won't need this. It's created when necessary using
+     * Device::as().
+     *
+     * @param backendObject the device interface object provided by the backend
+     * @see Solid::Device::as()
+     */
+    explicit NetworkInterface(QObject *backendObject);
+
+public:
+    /**
+     * Destroys a NetworkInterface object.
+     */
+    virtual ~NetworkInterface();
+
+    /**
+     * Get the Solid::DeviceInterface::Type of the NetworkInterface device interface.
+     *
+     * @return the NetworkInterface device interface type
+     * @see Solid::Ifaces::Enums::DeviceInterface::Type
+     */
+    static Type deviceInterfaceType()
+    {
+        return DeviceInterface::NetworkInterface;
+    }
+
+    /**
+     * Retrieves the name of the interface, e.g. "eth0".
+     *
+     * @return the interface name
+     */
+    QString interfaceName() const;
+
+    /**
+     * Retrieves the link layer address of the interface.
+     *
+     * @return the hardware address, e.g. "00:11:22:33:44:55"
+     */
+    QString hardwareAddress() const;
+
+    /**
+     * Indicates if this is a wireless interface.
+     *
+     * @return true if the interface is wireless
+     */
+    bool isWireless() const;
+
+    /**
+     * Retrieves the negotiated link speed.
+     *
+     * @return the speed in Mbit/s, -1 if unknown or the link is down
+     */
+    int speed() const;
+
+    /**
+     * Retrieves the negotiated duplex mode.
+     *
+     * @return the duplex mode
+     */
+    Duplex duplex() const;
+
+    /**
+     * Retrieves the maximum transmission unit.
+     *
+     * @return the MTU in bytes, 0 if unknown
+     */
+    int mtu() const;
+
+    /**
+     * Indicates if the physical link is up.
+     *
+     * @return true if a carrier is detected
+     */
+    bool hasCarrier() const;
+
+    /**
+     * Retrieves the operational state of the interface.
+     *
+     * @return the operational state
+     */
+    OperationalState operationalState() const;
+
+    /**
+     * Retrieves the number of receive queues, which on multi-queue
+     * adapters is usually the number of channels spread over the CPUs.
+     *
+     * @return the number of receive queues, 0 if unknown
+     */
+    int rxQueueCount() const;
+
+    /**
+     * Retrieves the number of transmit queues.
+     *
+     * @return the number of transmit queues, 0 if unknown
+     */
+    int txQueueCount() const;
+
+    /**
+     * Retrieves the traffic counters of the interface. Backends keep the
+     * underlying files open, so this is cheap enough to be polled; use
+     * Solid::NetworkInterfaceSampler to turn the counters into rates.
+     *
+     * @return the current traffic counters
+     */
+    Statistics statistics() const;
+
+    /**
+     * Retrieves the negotiated transfer rate of the PCI Express link the
+     * interface sits on, e.g. 8.0 for a PCIe 3.0 link.
+     *
+     * @return the transfer rate in GT/s, 0 if the interface isn't behind a
+     * PCI Express link
+     * @since 5.37
+     */
+    double pcieLinkSpeed() const;
+
+    /**
+     * Retrieves the negotiated number of lanes of the PCI Express link.
+     *
+     * @return the link width, 0 if unknown
+     * @since 5.37
+     */
+    int pcieLinkWidth() const;
+
+    /**
+     * Retrieves the highest transfer rate supported by both ends of the
+     * PCI Express link.
+     *
+     * @return the transfer rate in GT/s, 0 if unknown
+     * @since 5.37
+     */
+    double maxPcieLinkSpeed() const;
+
+    /**
+     * Retrieves the highest number of lanes supported by both ends of the
+     * PCI Express link.
+     *
+     * @return the link width, 0 if unknown
+     * @since 5.37
+     */
+    int maxPcieLinkWidth() const;
+
+    /**
+     * Indicates if the PCI Express link trained below what both of its
+     * ends support, for instance x4 instead of x8 or 8 GT/s instead of
+     * 16 GT/s, which caps the throughput of the interface. Note that some
+     * devices lower their link speed while idle to save power.
+     *
+     * @return true if the negotiated speed or width is below the maximum
+     * @since 5.37
+     */
+    bool isPcieLinkDegraded() const;
+};
+}
+
+#endif
@@ -0,0 +1,145 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "networkinterfacesampler.h"
+#include "sampler_p.h"
+
+namespace Solid
+{
+class NetworkInterfaceSamplerPrivate : public SamplerPrivate
+{
+public:
+    NetworkInterfaceSamplerPrivate(NetworkInterfaceSampler *q, const QList<Device> &devices)
+        : SamplerPrivate(q, SLOT(collect()), devices, DeviceInterface::NetworkInterface, 1000)
+    {
+    }
+
+    SampleHistory<NetworkInterface::Statistics> history;
+};
+}
+
+Solid::NetworkInterfaceSampler::NetworkInterfaceSampler(QObject *parent)
+    : QObject(parent),
+      d(new NetworkInterfaceSamplerPrivate(this, Device::listFromType(DeviceInterface::NetworkInterface)))
+{
+    qRegisterMetaType<Solid::NetworkInterfaceSampler::SampleList>();
+}
+
+Solid::NetworkInterfaceSampler::NetworkInterfaceSampler(const QList<Device> &devices, QObject *parent)
+    : QObject(parent),
+      d(new NetworkInterfaceSamplerPrivate(this, devices))
+{
+    qRegisterMetaType<Solid::NetworkInterfaceSampler::SampleList>();
+}
+
+Solid::NetworkInterfaceSampler::~NetworkInterfaceSampler()
+{
+    delete d;
+}
+
+int Solid::NetworkInterfaceSampler::interval() const
+{
+    return d->interval();
+}
+
+void Solid::NetworkInterfaceSampler::setInterval(int msec)
+{
+    d->setInterval(msec);
+}
+
+bool Solid::NetworkInterfaceSampler::isActive() const
+{
+    return d->isActive();
+}
+
+void Solid::NetworkInterfaceSampler::start()
+{
+    d->start();
+}
+
+void Solid::NetworkInterfaceSampler::stop()
+{
+    d->stop();
+}
+
+Solid::NetworkInterfaceSampler::SampleList Solid::NetworkInterfaceSampler::sample()
+{
+    SampleList samples;
+    samples.reserve(d->devices.size());
+
+    Q_FOREACH (const Device &device, d->devices) {
+        const NetworkInterface *iface = device.as<NetworkInterface>();
+        if (!iface) {
+            continue;
+        }
+
+        Sample sample;
+        sample.udi = device.udi();
+        sample.interfaceName = iface->interfaceName();
+        sample.statistics = iface->statistics();
+        const qint64 now = d->clock.nsecsElapsed();
+
+        if (!sample.statistics.valid) {
+            d->history.forget(sample.udi);
+            samples << sample;
+            continue;
+        }
+        sample.speed = iface->speed();
+
+        // a counter going backwards means the interface was re-created, or that
+        // a driver keeping 32 bit counters wrapped; that counts as no traffic
+        const NetworkInterface::Statistics &current = sample.statistics;
+        NetworkInterface::Statistics before;
+        qint64 elapsedNsecs;
+        if (d->history.advance(sample.udi, current, now, &before, &elapsedNsecs)) {
+            sample.interval = elapsedNsecs / 1000000;
+            sample.rxBytes = counterDelta(current.rxBytes, before.rxBytes);
+            sample.txBytes = counterDelta(current.txBytes, before.txBytes);
+            sample.rxPackets = counterDelta(current.rxPackets, before.rxPackets);
+            sample.txPackets = counterDelta(current.txPackets, before.txPackets);
+            sample.rxDropped = counterDelta(current.rxDropped, before.rxDropped);
+            sample.txDropped = counterDelta(current.txDropped, before.txDropped);
+            sample.rxErrors = counterDelta(current.rxErrors, before.rxErrors);
+            sample.txErrors = counterDelta(current.txErrors, before.txErrors);
+
+            if (elapsedNsecs > 0) {
+                const double seconds = elapsedNsecs / 1e9;
+                sample.rxBytesPerSecond = sample.rxBytes / seconds;
+                sample.txBytesPerSecond = sample.txBytes / seconds;
+                sample.rxPacketsPerSecond = sample.rxPackets / seconds;
+                sample.txPacketsPerSecond = sample.txPackets / seconds;
+                if (sample.speed > 0) {
+                    const double bytesPerSecond = sample.speed * 1e6 / 8;
+                    sample.rxUtilization = qMin(1.0, sample.rxBytesPerSecond / bytesPerSecond);
+                    sample.txUtilization = qMin(1.0, sample.txBytesPerSecond / bytesPerSecond);
+                }
+            }
+        }
+
+        samples << sample;
+    }
+
+    return samples;
+}
+
+void Solid::NetworkInterfaceSampler::collect()
+{
+    emit sampled(sample());
+}
@@ -0,0 +1,144 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_NETWORKINTERFACESAMPLER_H
+#define SOLID_NETWORKINTERFACESAMPLER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+
+#include <solid/solid_export.h>
+
+#include <solid/device.h>
+#include <solid/networkinterface.h>
+
+namespace Solid
+{
+class NetworkInterfaceSamplerPrivate;
+
+/**
+ * Periodically samples the traffic counters of a set of network interfaces
+ * and turns them into per-interface throughput: bytes and packets per
+ * second in each direction, drops, errors and link utilisation over the last
+ * interval.
+ *
+ * All interfaces are read in one go on every tick and reported through a
+ * single sampled() signal. Backends keep the counter files open between
+ * samples, so a tick costs one read per counter and no directory lookups.
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT NetworkInterfaceSampler : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int interval READ interval WRITE setInterval)
+    Q_PROPERTY(bool active READ isActive)
+
+public:
+    /**
+     * The traffic of one interface over the last interval.
+     */
+    struct Sample {
+        Sample()
+            : speed(-1), interval(0), rxBytes(0), txBytes(0), rxPackets(0), txPackets(0),
+              rxDropped(0), txDropped(0), rxErrors(0), txErrors(0),
+              rxBytesPerSecond(0), txBytesPerSecond(0), rxPacketsPerSecond(0), txPacketsPerSecond(0),
+              rxUtilization(0), txUtilization(0) {}
+
+        QString udi;
+        QString interfaceName;
+        /// the link speed in Mbit/s at the time of the sample, -1 if unknown
+        int speed;
+        /// the counters at the time of the sample
+        NetworkInterface::Statistics statistics;
+        /// milliseconds since the previous sample, 0 for the first one, in
+        /// which case all deltas and rates are 0 as well
+        qint64 interval;
+        /// the traffic during the interval
+        qulonglong rxBytes;
+        qulonglong txBytes;
+        qulonglong rxPackets;
+        qulonglong txPackets;
+        qulonglong rxDropped;
+        qulonglong txDropped;
+        qulonglong rxErrors;
+        qulonglong txErrors;
+        double rxBytesPerSecond;
+        double txBytesPerSecond;
+        double rxPacketsPerSecond;
+        double txPacketsPerSecond;
+        /// the fraction of the link speed used in each direction, between 0
+        /// and 1; 0 if the speed is unknown
+        double rxUtilization;
+        double txUtilization;
+    };
+    typedef QList<Sample> SampleList;
+
+    /**
+     * Creates a sampler for all network interfaces of the system.
+     */
+    explicit NetworkInterfaceSampler(QObject *parent = nullptr);
+
+    /**
+     * Creates a sampler for the given devices. Devices not providing the
+     * NetworkInterface interface are ignored.
+     */
+    explicit NetworkInterfaceSampler(const QList<Device> &devices, QObject *parent = nullptr);
+
+    ~NetworkInterfaceSampler();
+
+    /**
+     * @return the sampling interval in milliseconds, 1000 by default
+     */
+    int interval() const;
+    void setInterval(int msec);
+
+    bool isActive() const;
+
+    /**
+     * Takes a sample of all interfaces right away, without emitting
+     * sampled(). The deltas are relative to the previous sample, whether it
+     * was taken by the timer or by calling this method.
+     */
+    SampleList sample();
+
+public Q_SLOTS:
+    void start();
+    void stop();
+
+Q_SIGNALS:
+    /**
+     * Emitted once per interval with a sample of every interface.
+     */
+    void sampled(const Solid::NetworkInterfaceSampler::SampleList &samples);
+
+private Q_SLOTS:
+    void collect();
+
+private:
+    NetworkInterfaceSamplerPrivate *const d;
+};
+}
+
+Q_DECLARE_METATYPE(Solid::NetworkInterfaceSampler::Sample)
+Q_DECLARE_METATYPE(Solid::NetworkInterfaceSampler::SampleList)
+
+#endif
@@ -0,0 +1,139 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "numanode.h"
+#include "numanode_p.h"
+
+#include "soliddefs_p.h"
+#include <solid/devices/ifaces/numanode.h>
+
+#include <QtCore/QMetaMethod>
+
+static const qulonglong hugePageSize2M = Q_UINT64_C(2) << 20;
+static const qulonglong hugePageSize1G = Q_UINT64_C(1) << 30;
+
+Solid::NumaNode::NumaNode(QObject *backendObject)
+    : DeviceInterface(*new NumaNodePrivate(), backendObject)
+{
+}
+
+Solid::NumaNode::~NumaNode()
+{
+
+}
+
+void Solid::NumaNode::connectNotify(const QMetaMethod &signal)
+{
+    // only forward, and so make the backend poll, while someone listens
+    Q_D(NumaNode);
+    if (signal == QMetaMethod::fromSignal(&NumaNode::hugePagesChanged) && d->backendObject()) {
+        connect(d->backendObject(), SIGNAL(hugePagesChanged(QString)),
+                this, SIGNAL(hugePagesChanged(QString)), Qt::UniqueConnection);
+    }
+}
+
+void Solid::NumaNode::disconnectNotify(const QMetaMethod &signal)
+{
+    Q_D(NumaNode);
+    if ((!signal.isValid() || signal == QMetaMethod::fromSignal(&NumaNode::hugePagesChanged))
+            && !isSignalConnected(QMetaMethod::fromSignal(&NumaNode::hugePagesChanged))
+            && d->backendObject()) {
+        disconnect(d->backendObject(), SIGNAL(hugePagesChanged(QString)),
+                   this, SIGNAL(hugePagesChanged(QString)));
+    }
+}
+
+int Solid::NumaNode::number() const
+{
+    Q_D(const NumaNode);
+    return_SOLID_CALL(Ifaces::NumaNode *, d->backendObject(), -1, number());
+}
+
+QString Solid::NumaNode::cpuList() const
+{
+    Q_D(const NumaNode);
+    return_SOLID_CALL(Ifaces::NumaNode *, d->backendObject(), QString(), cpuList());
+}
+
+QList<int> Solid::NumaNode::distances() const
+{
+    Q_D(const NumaNode);
+    return_SOLID_CALL(Ifaces::NumaNode *, d->backendObject(), QList<int>(), distances());
+}
+
+qulonglong Solid::NumaNode::totalMemory() const
+{
+    Q_D(const NumaNode);
+    return_SOLID_CALL(Ifaces::NumaNode *, d->backendObject(), 0, totalMemory());
+}
+
+qulonglong Solid::NumaNode::freeMemory() const
+{
+    Q_D(const NumaNode);
+    return_SOLID_CALL(Ifaces::NumaNode *, d->backendObject(), 0, freeMemory());
+}
+
+Solid::NumaNode::HugePagePoolList Solid::NumaNode::hugePagePools() const
+{
+    Q_D(const NumaNode);
+    return_SOLID_CALL(Ifaces::NumaNode *, d->backendObject(), HugePagePoolList(), hugePagePools());
+}
+
+static Solid::NumaNode::HugePagePool findPool(const Solid::NumaNode::HugePagePoolList &pools, qulonglong pageSize)
+{
+    Q_FOREACH (const Solid::NumaNode::HugePagePool &pool, pools) {
+        if (pool.pageSize == pageSize) {
+            return pool;
+        }
+    }
+    return Solid::NumaNode::HugePagePool();
+}
+
+int Solid::NumaNode::totalHugePages2M() const
+{
+    return findPool(hugePagePools(), hugePageSize2M).total;
+}
+
+int Solid::NumaNode::freeHugePages2M() const
+{
+    return findPool(hugePagePools(), hugePageSize2M).free;
+}
+
+int Solid::NumaNode::totalHugePages1G() const
+{
+    return findPool(hugePagePools(), hugePageSize1G).total;
+}
+
+int Solid::NumaNode::freeHugePages1G() const
+{
+    return findPool(hugePagePools(), hugePageSize1G).free;
+}
+
+int Solid::NumaNode::memoryBlockCount() const
+{
+    Q_D(const NumaNode);
+    return_SOLID_CALL(Ifaces::NumaNode *, d->backendObject(), 0, memoryBlockCount());
+}
+
+int Solid::NumaNode::onlineMemoryBlockCount() const
+{
+    Q_D(const NumaNode);
+    return_SOLID_CALL(Ifaces::NumaNode *, d->backendObject(), 0, onlineMemoryBlockCount());
+}
@@ -0,0 +1,208 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_NUMANODE_H
+#define SOLID_NUMANODE_H
+
+#include <QtCore/QList>
+
+#include <solid/solid_export.h>
+
+#include <solid/deviceinterface.h>
+
+namespace Solid
+{
+class NumaNodePrivate;
+class Device;
+
+/**
+ * This device interface is available on the memory nodes of NUMA systems.
+ * It tells which processors are local to the node, how far the other
+ * nodes are, and how much memory and how many huge pages the node has
+ * available.
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT NumaNode : public DeviceInterface
+{
+    Q_OBJECT
+    Q_PROPERTY(int number READ number)
+    Q_PROPERTY(QString cpuList READ cpuList)
+    Q_PROPERTY(qulonglong totalMemory READ totalMemory)
+    Q_PROPERTY(qulonglong freeMemory READ freeMemory)
+    Q_PROPERTY(int totalHugePages2M READ totalHugePages2M)
+    Q_PROPERTY(int freeHugePages2M READ freeHugePages2M)
+    Q_PROPERTY(int totalHugePages1G READ totalHugePages1G)
+    Q_PROPERTY(int freeHugePages1G READ freeHugePages1G)
+    Q_PROPERTY(int memoryBlockCount READ memoryBlockCount)
+    Q_PROPERTY(int onlineMemoryBlockCount READ onlineMemoryBlockCount)
+    Q_DECLARE_PRIVATE(NumaNode)
+    friend class Device;
+
+public:
+    /**
+     * The huge pages of one size reserved on a node.
+     */
+    struct HugePagePool {
+        HugePagePool()
+            : pageSize(0), total(0), free(0), surplus(0) {}
+
+        /// the page size in bytes
+        qulonglong pageSize;
+        /// the number of pages in the pool
+        int total;
+        /// the number of pages not allocated yet
+        int free;
+        /// the number of pages allocated beyond the pool size on demand
+        int surplus;
+    };
+    typedef QList<HugePagePool> HugePagePoolList;
+
+private:
+    /**
+     * Creates a new NumaNode object.
+     * You generally won't need this. It's created when necessary using
+     * Device::as().
+     *
+     * @param backendObject the device interface object provided by the backend
+     * @see Solid::Device::as()
+     */
+    explicit NumaNode(QObject *backendObject);
+
+public:
+    /**
+     * Destroys a NumaNode object.
+     */
+    virtual ~NumaNode();
+
+    /**
+     * Get the Solid::DeviceInterface::Type of the NumaNode device interface.
+     *
+     * @return the NumaNode device interface type
+     * @see Solid::Ifaces::Enums::DeviceInterface::Type
+     */
+    static Type deviceInterfaceType()
+    {
+        return DeviceInterface::NumaNode;
+    }
+
+    /**
+     * Retrieves the number of the node, as used by Processor::numaNode().
+     *
+     * @return the node number
+     */
+    int number() const;
+
+    /**
+     * Retrieves the processors local to this node.
+     *
+     * @return the processor numbers in the kernel's list format, e.g. "0-7,16-23"
+     */
+    QString cpuList() const;
+
+    /**
+     * Retrieves the relative cost of accessing memory on every node from
+     * this node, as reported by the ACPI SLIT table. Access to the local
+     * memory costs 10.
+     *
+     * @return the distances, indexed by node number
+     */
+    QList<int> distances() const;
+
+    /**
+     * Retrieves the amount of memory of the node.
+     *
+     * @return the memory in bytes
+     */
+    qulonglong totalMemory() const;
+
+    /**
+     * Retrieves the amount of memory of the node not in use.
+     *
+     * @return the free memory in bytes
+     */
+    qulonglong freeMemory() const;
+
+    /**
+     * Retrieves the huge page pools of the node, one per supported page size.
+     *
+     * @return the pools sorted by page size
+     */
+    HugePagePoolList hugePagePools() const;
+
+    /**
+     * Retrieves the size of the 2 MiB huge page pool of the node.
+     *
+     * @return the number of pages, 0 if there is no such pool
+     */
+    int totalHugePages2M() const;
+
+    /**
+     * Retrieves the number of free pages in the 2 MiB huge page pool.
+     *
+     * @return the number of pages, 0 if there is no such pool
+     */
+    int freeHugePages2M() const;
+
+    /**
+     * Retrieves the size of the 1 GiB huge page pool of the node.
+     *
+     * @return the number of pages, 0 if there is no such pool
+     */
+    int totalHugePages1G() const;
+
+    /**
+     * Retrieves the number of free pages in the 1 GiB huge page pool.
+     *
+     * @return the number of pages, 0 if there is no such pool
+     */
+    int freeHugePages1G() const;
+
+    /**
+     * Retrieves the number of hot-pluggable memory blocks of the node.
+     *
+     * @return the number of memory blocks
+     */
+    int memoryBlockCount() const;
+
+    /**
+     * Retrieves the number of memory blocks of the node that are online.
+     *
+     * @return the number of online memory blocks
+     */
+    int onlineMemoryBlockCount() const;
+
+Q_SIGNALS:
+    /**
+     * This signal is emitted when the size or the number of free pages of
+     * a huge page pool of the node changed. The kernel doesn't notify about
+     * this, backends poll the pools while the signal is connected.
+     *
+     * @param udi the UDI of the node
+     */
+    void hugePagesChanged(const QString &udi);
+
+protected:
+    void connectNotify(const QMetaMethod &signal) Q_DECL_OVERRIDE;
+    void disconnectNotify(const QMetaMethod &signal) Q_DECL_OVERRIDE;
+};
+}
+
+#endif
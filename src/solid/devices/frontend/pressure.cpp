@@ -0,0 +1,77 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "pressure.h"
+#include "pressure_p.h"
+
+#include "soliddefs_p.h"
+#include <solid/devices/ifaces/pressure.h>
+
+Solid::Pressure::Pressure(QObject *backendObject)
+    : DeviceInterface(*new PressurePrivate(), backendObject)
+{
+    connect(backendObject, SIGNAL(triggered(int,QString)),
+            this, SIGNAL(triggered(int,QString)));
+}
+
+Solid::Pressure::~Pressure()
+{
+
+}
+
+Solid::Pressure::Resource Solid::Pressure::resource() const
+{
+    Q_D(const Pressure);
+    return_SOLID_CALL(Ifaces::Pressure *, d->backendObject(), UnknownResource, resource());
+}
+
+Solid::Pressure::Stall Solid::Pressure::some() const
+{
+    Q_D(const Pressure);
+    return_SOLID_CALL(Ifaces::Pressure *, d->backendObject(), Stall(), stall(Some));
+}
+
+Solid::Pressure::Stall Solid::Pressure::full() const
+{
+    Q_D(const Pressure);
+    return_SOLID_CALL(Ifaces::Pressure *, d->backendObject(), Stall(), stall(Full));
+}
+
+double Solid::Pressure::someAvg10() const
+{
+    return some().avg10;
+}
+
+double Solid::Pressure::fullAvg10() const
+{
+    return full().avg10;
+}
+
+int Solid::Pressure::addTrigger(StallType type, qulonglong threshold, qulonglong window)
+{
+    Q_D(Pressure);
+    return_SOLID_CALL(Ifaces::Pressure *, d->backendObject(), -1, addTrigger(type, threshold, window));
+}
+
+void Solid::Pressure::removeTrigger(int id)
+{
+    Q_D(Pressure);
+    SOLID_CALL(Ifaces::Pressure *, d->backendObject(), removeTrigger(id));
+}
@@ -0,0 +1,192 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_PRESSURE_H
+#define SOLID_PRESSURE_H
+
+#include <solid/solid_export.h>
+
+#include <solid/deviceinterface.h>
+
+namespace Solid
+{
+class PressurePrivate;
+class Device;
+
+/**
+ * This device interface is available on the pressure stall information
+ * (PSI) of a system resource. It reports the share of time tasks were
+ * stalled waiting for the CPU, for memory or for I/O, which tells more
+ * about contention than utilisation does.
+ *
+ * Instead of polling, applications can register triggers with addTrigger().
+ * The kernel then notifies when the stall time within a window exceeds a
+ * threshold, and Solid emits triggered().
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT Pressure : public DeviceInterface
+{
+    Q_OBJECT
+    Q_PROPERTY(Resource resource READ resource)
+    Q_PROPERTY(double someAvg10 READ someAvg10)
+    Q_PROPERTY(double fullAvg10 READ fullAvg10)
+    Q_DECLARE_PRIVATE(Pressure)
+    friend class Device;
+
+public:
+    /**
+     * This enum type defines the resource a pressure is reported for.
+     *
+     * - UnknownResource : the resource isn't known to Solid
+     * - Cpu : the processors
+     * - Memory : the memory, including reclaim and swapping
+     * - Io : the block devices
+     */
+    enum Resource { UnknownResource, Cpu, Memory, Io };
+    Q_ENUM(Resource)
+
+    /**
+     * This enum type defines which stalls are accounted.
+     *
+     * - Some : at least one task was stalled on the resource
+     * - Full : all non-idle tasks were stalled at the same time
+     */
+    enum StallType { Some, Full };
+    Q_ENUM(StallType)
+
+    /**
+     * The stall figures of one stall type.
+     */
+    struct Stall {
+        Stall()
+            : avg10(0), avg60(0), avg300(0), total(0) {}
+
+        /// the percentage of stalled time over the last 10 seconds
+        double avg10;
+        /// the percentage of stalled time over the last 60 seconds
+        double avg60;
+        /// the percentage of stalled time over the last 300 seconds
+        double avg300;
+        /// the total stalled time in microseconds
+        qulonglong total;
+    };
+
+private:
+    /**
+     * Creates a new Pressure object.
+     * You generally won't need this. It's created when necessary using
+     * Device::as().
+     *
+     * @param backendObject the device interface object provided by the backend
+     * @see Solid::Device::as()
+     */
+    explicit Pressure(QObject *backendObject);
+
+public:
+    /**
+     * Destroys a Pressure object. The triggers registered through it stay
+     * active as long as the device object lives.
+     */
+    virtual ~Pressure();
+
+    /**
+     * Get the Solid::DeviceInterface::Type of the Pressure device interface.
+     *
+     * @return the Pressure device interface type
+     * @see Solid::Ifaces::Enums::DeviceInterface::Type
+     */
+    static Type deviceInterfaceType()
+    {
+        return DeviceInterface::Pressure;
+    }
+
+    /**
+     * Retrieves the resource the pressure is reported for.
+     *
+     * @return the resource
+     */
+    Resource resource() const;
+
+    /**
+     * Retrieves the time during which at least one task was stalled.
+     *
+     * @return the current figures
+     */
+    Stall some() const;
+
+    /**
+     * Retrieves the time during which all non-idle tasks were stalled. It
+     * is always zero for the CPU pressure of the whole system.
+     *
+     * @return the current figures
+     */
+    Stall full() const;
+
+    /**
+     * Convenience for some().avg10.
+     *
+     * @return the percentage of time at least one task was stalled over
+     * the last 10 seconds
+     */
+    double someAvg10() const;
+
+    /**
+     * Convenience for full().avg10.
+     *
+     * @return the percentage of time all non-idle tasks were stalled over
+     * the last 10 seconds
+     */
+    double fullAvg10() const;
+
+    /**
+     * Registers a trigger, which makes triggered() be emitted whenever the
+     * stall time within a window of the given size exceeds the threshold.
+     * The kernel limits the window to between 500ms and 10s, and allows
+     * unprivileged processes only windows that are a multiple of 2s.
+     *
+     * @param type the stalls to account
+     * @param threshold the stall time in microseconds
+     * @param window the window size in microseconds
+     * @return an identifier for the trigger, or -1 if it couldn't be
+     * registered
+     */
+    int addTrigger(StallType type, qulonglong threshold, qulonglong window);
+
+    /**
+     * Unregisters a trigger.
+     *
+     * @param id the identifier returned by addTrigger()
+     */
+    void removeTrigger(int id);
+
+Q_SIGNALS:
+    /**
+     * This signal is emitted when the threshold of a trigger was exceeded.
+     * The kernel signals a trigger at most once per window.
+     *
+     * @param id the identifier of the trigger
+     * @param udi the UDI of the pressure device
+     */
+    void triggered(int id, const QString &udi);
+};
+}
+
+#endif
@@ -58,3 +58,151 @@ Solid::Processor::InstructionSets Solid::Processor::instructionSets() const
     return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), InstructionSets(), instructionSets());
 }
 
+int Solid::Processor::packageId() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), -1, packageId());
+}
+
+int Solid::Processor::dieId() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), -1, dieId());
+}
+
+int Solid::Processor::coreId() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), -1, coreId());
+}
+
+int Solid::Processor::threadId() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), -1, threadId());
+}
+
+int Solid::Processor::numaNode() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), -1, numaNode());
+}
+
+QString Solid::Processor::threadSiblings() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), QString(), threadSiblings());
+}
+
+QString Solid::Processor::packageSiblings() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), QString(), packageSiblings());
+}
+
+Solid::Processor::CacheList Solid::Processor::caches() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), CacheList(), caches());
+}
+
+static const Solid::Processor::Cache *findCache(const Solid::Processor::CacheList &caches, int level,
+                                                Solid::Processor::CacheType type)
+{
+    for (int i = 0; i < caches.size(); ++i) {
+        const Solid::Processor::Cache &cache = caches.at(i);
+        if (cache.level == level && cache.type == type) {
+            return &cache;
+        }
+    }
+    return nullptr;
+}
+
+qulonglong Solid::Processor::l1DataCacheSize() const
+{
+    const CacheList list = caches();
+    const Cache *cache = findCache(list, 1, DataCache);
+    return cache ? cache->size : 0;
+}
+
+qulonglong Solid::Processor::l1InstructionCacheSize() const
+{
+    const CacheList list = caches();
+    const Cache *cache = findCache(list, 1, InstructionCache);
+    return cache ? cache->size : 0;
+}
+
+qulonglong Solid::Processor::l2CacheSize() const
+{
+    const CacheList list = caches();
+    const Cache *cache = findCache(list, 2, UnifiedCache);
+    return cache ? cache->size : 0;
+}
+
+qulonglong Solid::Processor::l3CacheSize() const
+{
+    const CacheList list = caches();
+    const Cache *cache = findCache(list, 3, UnifiedCache);
+    return cache ? cache->size : 0;
+}
+
+int Solid::Processor::cacheLineSize() const
+{
+    const CacheList list = caches();
+    const Cache *cache = findCache(list, 1, DataCache);
+    if (!cache) {
+        cache = findCache(list, 1, UnifiedCache);
+    }
+    return cache ? cache->lineSize : 0;
+}
+
+QString Solid::Processor::l2SharedCpus() const
+{
+    const CacheList list = caches();
+    const Cache *cache = findCache(list, 2, UnifiedCache);
+    return cache ? cache->sharedCpus : QString();
+}
+
+QString Solid::Processor::l3SharedCpus() const
+{
+    const CacheList list = caches();
+    const Cache *cache = findCache(list, 3, UnifiedCache);
+    return cache ? cache->sharedCpus : QString();
+}
+
+int Solid::Processor::currentSpeed() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), 0, currentSpeed());
+}
+
+QString Solid::Processor::governor() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), QString(), governor());
+}
+
+QString Solid::Processor::energyPerformancePreference() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), QString(), energyPerformancePreference());
+}
+
+Solid::Processor::IdleStateList Solid::Processor::idleStates() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), IdleStateList(), idleStates());
+}
+
+qlonglong Solid::Processor::coreThrottleCount() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), -1, coreThrottleCount());
+}
+
+qlonglong Solid::Processor::packageThrottleCount() const
+{
+    Q_D(const Processor);
+    return_SOLID_CALL(Ifaces::Processor *, d->backendObject(), -1, packageThrottleCount());
+}
+
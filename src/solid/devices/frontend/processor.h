@@ -25,6 +25,9 @@
 
 #include <solid/deviceinterface.h>
 
+#include <QtCore/QList>
+#include <QtCore/QString>
+
 namespace Solid
 {
 class ProcessorPrivate;
@@ -40,6 +43,25 @@ class SOLID_EXPORT Processor : public DeviceInterface
     Q_PROPERTY(qulonglong maxSpeed READ maxSpeed)
     Q_PROPERTY(bool canChangeFrequency READ canChangeFrequency)
     Q_PROPERTY(InstructionSets instructionSets READ instructionSets)
+    Q_PROPERTY(int packageId READ packageId)
+    Q_PROPERTY(int dieId READ dieId)
+    Q_PROPERTY(int coreId READ coreId)
+    Q_PROPERTY(int threadId READ threadId)
+    Q_PROPERTY(int numaNode READ numaNode)
+    Q_PROPERTY(QString threadSiblings READ threadSiblings)
+    Q_PROPERTY(QString packageSiblings READ packageSiblings)
+    Q_PROPERTY(qulonglong l1DataCacheSize READ l1DataCacheSize)
+    Q_PROPERTY(qulonglong l1InstructionCacheSize READ l1InstructionCacheSize)
+    Q_PROPERTY(qulonglong l2CacheSize READ l2CacheSize)
+    Q_PROPERTY(qulonglong l3CacheSize READ l3CacheSize)
+    Q_PROPERTY(int cacheLineSize READ cacheLineSize)
+    Q_PROPERTY(QString l2SharedCpus READ l2SharedCpus)
+    Q_PROPERTY(QString l3SharedCpus READ l3SharedCpus)
+    Q_PROPERTY(int currentSpeed READ currentSpeed)
+    Q_PROPERTY(QString governor READ governor)
+    Q_PROPERTY(QString energyPerformancePreference READ energyPerformancePreference)
+    Q_PROPERTY(qlonglong coreThrottleCount READ coreThrottleCount)
+    Q_PROPERTY(qlonglong packageThrottleCount READ packageThrottleCount)
     Q_DECLARE_PRIVATE(Processor)
     friend class Device;
 
@@ -58,6 +80,20 @@ public:
     /**
      * This enum contains the list of architecture extensions you
      * can query.
+     *
+     * An extension is only reported when the processor implements it
+     * and the operating system saves the register state it needs, so
+     * the AVX, AVX-512 and AMX families are absent when the kernel
+     * doesn't enable them even if the processor supports them.
+     *
+     * - IntelAvx ... IntelVaes: AVX and the extensions introduced with
+     *   or after it (FMA3, F16C, BMI1/2, SHA, VAES) (since 5.37)
+     * - IntelAvx512F ... IntelAvx512Vbmi: the AVX-512 foundation and
+     *   the subsets most code dispatches on; the subsets are only
+     *   reported together with IntelAvx512F (since 5.37)
+     * - IntelAmxTile ... IntelAmxInt8: the Advanced Matrix Extensions;
+     *   on Linux a process still has to request the tile state with
+     *   arch_prctl() before using them (since 5.37)
      */
     enum InstructionSet {
         NoExtensions = 0x0,
@@ -70,7 +106,26 @@ public:
         IntelSse41 = 0x10,
         IntelSse42 = 0x100,
         Amd3DNow = 0x20,
-        AltiVec = 0x40
+        AltiVec = 0x40,
+        IntelAvx = 0x200,
+        IntelAvx2 = 0x400,
+        IntelFma = 0x800,
+        IntelF16c = 0x1000,
+        IntelBmi1 = 0x2000,
+        IntelBmi2 = 0x4000,
+        IntelSha = 0x8000,
+        IntelVaes = 0x10000,
+        IntelAvx512F = 0x20000,
+        IntelAvx512Cd = 0x40000,
+        IntelAvx512Dq = 0x80000,
+        IntelAvx512Bw = 0x100000,
+        IntelAvx512Vl = 0x200000,
+        IntelAvx512Vnni = 0x400000,
+        IntelAvx512Ifma = 0x800000,
+        IntelAvx512Vbmi = 0x1000000,
+        IntelAmxTile = 0x2000000,
+        IntelAmxBf16 = 0x4000000,
+        IntelAmxInt8 = 0x8000000
     };
     Q_ENUM(InstructionSet)
 
@@ -80,6 +135,57 @@ public:
     Q_DECLARE_FLAGS(InstructionSets, InstructionSet)
     Q_FLAG(InstructionSets)
 
+    /**
+     * This enum describes what a CPU cache holds.
+     */
+    enum CacheType {
+        UnifiedCache = 0,
+        DataCache = 1,
+        InstructionCache = 2
+    };
+    Q_ENUM(CacheType)
+
+    /**
+     * Describes one cache the processor has access to.
+     */
+    struct Cache {
+        Cache() : level(0), type(UnifiedCache), size(0), lineSize(0), ways(0) {}
+
+        /// the cache level, starting at 1
+        int level;
+        CacheType type;
+        /// the size in bytes
+        qulonglong size;
+        /// the coherency line size in bytes
+        int lineSize;
+        /// the associativity, 0 if unknown
+        int ways;
+        /// the logical processors sharing this cache, in the kernel's
+        /// cpu list format (e.g. "0-3,8-11")
+        QString sharedCpus;
+    };
+    typedef QList<Cache> CacheList;
+
+    /**
+     * Describes one idle state (C-state) the processor can enter, together
+     * with how much it has been used so far.
+     */
+    struct IdleState {
+        IdleState() : exitLatency(0), targetResidency(0), time(0), usage(0), disabled(false) {}
+
+        QString name;
+        /// the worst case exit latency in microseconds
+        int exitLatency;
+        /// the minimum residency in microseconds for the state to pay off
+        int targetResidency;
+        /// the total time spent in the state in microseconds
+        qulonglong time;
+        /// how many times the state has been entered
+        qulonglong usage;
+        bool disabled;
+    };
+    typedef QList<IdleState> IdleStateList;
+
     /**
      * Destroys a Processor object.
      */
@@ -128,6 +234,189 @@ public:
      * @see Solid::Processor::InstructionSet
      */
     InstructionSets instructionSets() const;
+
+    /**
+     * Retrieves the physical package (socket) the processor belongs to.
+     *
+     * @return the package id, or -1 if unknown
+     * @since 5.37
+     */
+    int packageId() const;
+
+    /**
+     * Retrieves the die within its package the processor belongs to.
+     *
+     * @return the die id, or -1 if unknown
+     * @since 5.37
+     */
+    int dieId() const;
+
+    /**
+     * Retrieves the core within its package the processor belongs to.
+     *
+     * Core ids are not necessarily contiguous.
+     *
+     * @return the core id, or -1 if unknown
+     * @since 5.37
+     */
+    int coreId() const;
+
+    /**
+     * Retrieves the position of this logical processor among the hardware
+     * threads of its core.
+     *
+     * @return the thread index starting from zero, or -1 if unknown
+     * @since 5.37
+     */
+    int threadId() const;
+
+    /**
+     * Retrieves the NUMA node the processor belongs to.
+     *
+     * @return the NUMA node number, or -1 if unknown
+     * @since 5.37
+     */
+    int numaNode() const;
+
+    /**
+     * Retrieves the logical processors sharing this processor's core,
+     * including this one.
+     *
+     * @return a cpu list such as "0,64", or an empty string if unknown
+     * @since 5.37
+     */
+    QString threadSiblings() const;
+
+    /**
+     * Retrieves the logical processors sharing this processor's package,
+     * including this one.
+     *
+     * @return a cpu list such as "0-31,64-95", or an empty string if unknown
+     * @since 5.37
+     */
+    QString packageSiblings() const;
+
+    /**
+     * Retrieves the caches the processor has access to.
+     *
+     * @return the caches ordered by level, or an empty list if unknown
+     * @since 5.37
+     */
+    CacheList caches() const;
+
+    /**
+     * Retrieves the size of the level 1 data cache.
+     *
+     * @return the size in bytes, or 0 if unknown
+     * @since 5.37
+     */
+    qulonglong l1DataCacheSize() const;
+
+    /**
+     * Retrieves the size of the level 1 instruction cache.
+     *
+     * @return the size in bytes, or 0 if unknown
+     * @since 5.37
+     */
+    qulonglong l1InstructionCacheSize() const;
+
+    /**
+     * Retrieves the size of the level 2 cache.
+     *
+     * @return the size in bytes, or 0 if unknown
+     * @since 5.37
+     */
+    qulonglong l2CacheSize() const;
+
+    /**
+     * Retrieves the size of the level 3 cache.
+     *
+     * @return the size in bytes, or 0 if unknown
+     * @since 5.37
+     */
+    qulonglong l3CacheSize() const;
+
+    /**
+     * Retrieves the line size of the level 1 data cache.
+     *
+     * @return the line size in bytes, or 0 if unknown
+     * @since 5.37
+     */
+    int cacheLineSize() const;
+
+    /**
+     * Retrieves the logical processors sharing the level 2 cache.
+     *
+     * @return a cpu list, or an empty string if unknown
+     * @since 5.37
+     */
+    QString l2SharedCpus() const;
+
+    /**
+     * Retrieves the logical processors sharing the level 3 cache.
+     *
+     * @return a cpu list, or an empty string if unknown
+     * @since 5.37
+     */
+    QString l3SharedCpus() const;
+
+    /**
+     * Retrieves the current speed of the processor.
+     *
+     * Unlike the other properties this is read live on every call; use
+     * Solid::ProcessorTelemetry to sample many processors periodically.
+     *
+     * @return the current speed in MHz, or 0 if unknown
+     * @since 5.37
+     */
+    int currentSpeed() const;
+
+    /**
+     * Retrieves the frequency scaling governor driving the processor.
+     *
+     * @return the governor name such as "schedutil", or an empty string if
+     * the processor isn't frequency scaled
+     * @since 5.37
+     */
+    QString governor() const;
+
+    /**
+     * Retrieves the energy/performance preference hint of the processor.
+     *
+     * @return the preference such as "balance_performance", or an empty
+     * string if the driver doesn't support one
+     * @since 5.37
+     */
+    QString energyPerformancePreference() const;
+
+    /**
+     * Retrieves the idle states of the processor and their usage.
+     *
+     * @return the idle states from the shallowest to the deepest one
+     * @since 5.37
+     */
+    IdleStateList idleStates() const;
+
+    /**
+     * Retrieves how many times the core of this processor was throttled
+     * because it got too hot. Solid::SensorSampler notifies about new
+     * throttling events.
+     *
+     * @return the number of thermal throttling events since boot, -1 if the
+     * processor doesn't report them
+     * @since 5.37
+     */
+    qlonglong coreThrottleCount() const;
+
+    /**
+     * Retrieves how many times the package containing this processor was
+     * throttled because it got too hot.
+     *
+     * @return the number of thermal throttling events since boot, -1 if the
+     * processor doesn't report them
+     * @since 5.37
+     */
+    qlonglong packageThrottleCount() const;
 };
 }
 
@@ -0,0 +1,123 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "processortelemetry.h"
+#include "sampler_p.h"
+
+namespace Solid
+{
+class ProcessorTelemetryPrivate : public SamplerPrivate
+{
+public:
+    ProcessorTelemetryPrivate(ProcessorTelemetry *q, const QList<Device> &devices)
+        : SamplerPrivate(q, SLOT(collect()), devices, DeviceInterface::Processor, 1000)
+    {
+    }
+
+    // the time spent in any idle state
+    SampleHistory<qulonglong> idleTime;
+};
+}
+
+Solid::ProcessorTelemetry::ProcessorTelemetry(QObject *parent)
+    : QObject(parent),
+      d(new ProcessorTelemetryPrivate(this, Device::listFromType(DeviceInterface::Processor)))
+{
+    qRegisterMetaType<Solid::ProcessorTelemetry::SampleList>();
+}
+
+Solid::ProcessorTelemetry::ProcessorTelemetry(const QList<Device> &processors, QObject *parent)
+    : QObject(parent),
+      d(new ProcessorTelemetryPrivate(this, processors))
+{
+    qRegisterMetaType<Solid::ProcessorTelemetry::SampleList>();
+}
+
+Solid::ProcessorTelemetry::~ProcessorTelemetry()
+{
+    delete d;
+}
+
+int Solid::ProcessorTelemetry::interval() const
+{
+    return d->interval();
+}
+
+void Solid::ProcessorTelemetry::setInterval(int msec)
+{
+    d->setInterval(msec);
+}
+
+bool Solid::ProcessorTelemetry::isActive() const
+{
+    return d->isActive();
+}
+
+void Solid::ProcessorTelemetry::start()
+{
+    d->start();
+}
+
+void Solid::ProcessorTelemetry::stop()
+{
+    d->stop();
+}
+
+Solid::ProcessorTelemetry::SampleList Solid::ProcessorTelemetry::sample()
+{
+    SampleList samples;
+    samples.reserve(d->devices.size());
+
+    Q_FOREACH (const Device &device, d->devices) {
+        const Processor *processor = device.as<Processor>();
+        if (!processor) {
+            continue;
+        }
+
+        Sample sample;
+        sample.udi = device.udi();
+        sample.number = processor->number();
+        sample.currentSpeed = processor->currentSpeed();
+        sample.maxSpeed = processor->maxSpeed();
+        sample.governor = processor->governor();
+        sample.energyPerformancePreference = processor->energyPerformancePreference();
+        sample.idleStates = processor->idleStates();
+
+        qulonglong idleTime = 0;
+        Q_FOREACH (const Processor::IdleState &state, sample.idleStates) {
+            idleTime += state.time;
+        }
+        // the counters restart when a processor goes offline
+        qulonglong lastIdleTime;
+        qint64 elapsedNsecs;
+        if (d->idleTime.advance(sample.udi, idleTime, d->clock.nsecsElapsed(), &lastIdleTime, &elapsedNsecs)) {
+            sample.idleTimeDelta = counterDelta(idleTime, lastIdleTime);
+        }
+
+        samples << sample;
+    }
+
+    return samples;
+}
+
+void Solid::ProcessorTelemetry::collect()
+{
+    emit sampled(sample());
+}
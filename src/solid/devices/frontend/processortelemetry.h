@@ -0,0 +1,123 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_PROCESSORTELEMETRY_H
+#define SOLID_PROCESSORTELEMETRY_H
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+
+#include <solid/solid_export.h>
+
+#include <solid/device.h>
+#include <solid/processor.h>
+
+namespace Solid
+{
+class ProcessorTelemetryPrivate;
+
+/**
+ * Periodically samples the live state of a set of processors: their current
+ * speed, frequency governor, energy/performance preference and idle state
+ * usage.
+ *
+ * All processors are read in one go on every tick and reported through a
+ * single sampled() signal. Backends keep the underlying files open between
+ * samples, which keeps a short interval cheap even on large hosts.
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT ProcessorTelemetry : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int interval READ interval WRITE setInterval)
+    Q_PROPERTY(bool active READ isActive)
+
+public:
+    /**
+     * The state of one processor at the time of a sample.
+     */
+    struct Sample {
+        Sample() : number(-1), currentSpeed(0), maxSpeed(0), idleTimeDelta(0) {}
+
+        QString udi;
+        int number;
+        /// the current speed in MHz, 0 if unknown
+        int currentSpeed;
+        /// the maximum speed in MHz, 0 if unknown
+        int maxSpeed;
+        QString governor;
+        QString energyPerformancePreference;
+        Processor::IdleStateList idleStates;
+        /// microseconds spent in any idle state since the previous sample,
+        /// 0 for the first one
+        qulonglong idleTimeDelta;
+    };
+    typedef QList<Sample> SampleList;
+
+    /**
+     * Creates a telemetry object sampling all processors of the system.
+     */
+    explicit ProcessorTelemetry(QObject *parent = nullptr);
+
+    /**
+     * Creates a telemetry object sampling the given processors. Devices not
+     * providing the Processor interface are ignored.
+     */
+    explicit ProcessorTelemetry(const QList<Device> &processors, QObject *parent = nullptr);
+
+    ~ProcessorTelemetry();
+
+    /**
+     * @return the sampling interval in milliseconds, 1000 by default
+     */
+    int interval() const;
+    void setInterval(int msec);
+
+    bool isActive() const;
+
+    /**
+     * Takes a sample of all processors right away, without emitting sampled().
+     */
+    SampleList sample();
+
+public Q_SLOTS:
+    void start();
+    void stop();
+
+Q_SIGNALS:
+    /**
+     * Emitted once per interval with a sample of every processor.
+     */
+    void sampled(const Solid::ProcessorTelemetry::SampleList &samples);
+
+private Q_SLOTS:
+    void collect();
+
+private:
+    ProcessorTelemetryPrivate *const d;
+};
+}
+
+Q_DECLARE_METATYPE(Solid::ProcessorTelemetry::Sample)
+Q_DECLARE_METATYPE(Solid::ProcessorTelemetry::SampleList)
+
+#endif
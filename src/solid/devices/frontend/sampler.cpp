@@ -0,0 +1,59 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "sampler_p.h"
+
+Solid::SamplerPrivate::SamplerPrivate(QObject *sampler, const char *slot, const QList<Device> &candidates,
+                                      DeviceInterface::Type type, int interval)
+{
+    Q_FOREACH (const Device &device, candidates) {
+        if (device.isDeviceInterface(type)) {
+            devices << device;
+        }
+    }
+    clock.start();
+    timer.setInterval(interval);
+    QObject::connect(&timer, SIGNAL(timeout()), sampler, slot);
+}
+
+int Solid::SamplerPrivate::interval() const
+{
+    return timer.interval();
+}
+
+void Solid::SamplerPrivate::setInterval(int msec)
+{
+    timer.setInterval(qMax(1, msec));
+}
+
+bool Solid::SamplerPrivate::isActive() const
+{
+    return timer.isActive();
+}
+
+void Solid::SamplerPrivate::start()
+{
+    timer.start();
+}
+
+void Solid::SamplerPrivate::stop()
+{
+    timer.stop();
+}
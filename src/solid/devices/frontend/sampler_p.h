@@ -0,0 +1,119 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_SAMPLER_P_H
+#define SOLID_SAMPLER_P_H
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QTimer>
+
+#include "device.h"
+
+namespace Solid
+{
+/**
+ * What the periodic samplers have in common: the devices they read, the
+ * timer driving them and a monotonic clock to timestamp readings with. The
+ * private class of each sampler derives from it and only adds what is
+ * specific to its source.
+ */
+class SamplerPrivate
+{
+public:
+    /**
+     * Keeps the devices of @p candidates providing @p type and ticks @p slot
+     * of @p sampler every @p interval milliseconds once started.
+     */
+    SamplerPrivate(QObject *sampler, const char *slot, const QList<Device> &candidates,
+                   DeviceInterface::Type type, int interval);
+
+    int interval() const;
+    void setInterval(int msec);
+    bool isActive() const;
+    void start();
+    void stop();
+
+    QList<Device> devices;
+    QElapsedTimer clock;
+    QTimer timer;
+};
+
+/**
+ * The difference between two readings of a counter. A counter going
+ * backwards restarted, e.g. because its device was re-created, which is
+ * reported as no change rather than as a spike. Signed counters are negative
+ * when the source doesn't provide them.
+ */
+inline qulonglong counterDelta(qulonglong current, qulonglong previous)
+{
+    return current >= previous ? current - previous : 0;
+}
+
+inline qulonglong counterDelta(qlonglong current, qlonglong previous)
+{
+    return current >= 0 && previous >= 0 && current > previous ? current - previous : 0;
+}
+
+/**
+ * The previous reading of every sampled device, keyed by udi.
+ */
+template<typename Counters>
+class SampleHistory
+{
+public:
+    /**
+     * Remembers @p current as the reading of @p udi taken at @p now.
+     * @return false for the first reading of a device; otherwise @p previous
+     * and @p elapsed receive the previous reading and the nanoseconds since
+     */
+    bool advance(const QString &udi, const Counters &current, qint64 now, Counters *previous, qint64 *elapsed)
+    {
+        typename QHash<QString, Entry>::iterator last = m_entries.find(udi);
+        if (last == m_entries.end()) {
+            const Entry entry = { current, now };
+            m_entries.insert(udi, entry);
+            return false;
+        }
+
+        *previous = last->counters;
+        *elapsed = now - last->timestamp;
+        last->counters = current;
+        last->timestamp = now;
+        return true;
+    }
+
+    void forget(const QString &udi)
+    {
+        m_entries.remove(udi);
+    }
+
+private:
+    struct Entry {
+        Counters counters;
+        qint64 timestamp;
+    };
+
+    QHash<QString, Entry> m_entries;
+};
+}
+
+#endif
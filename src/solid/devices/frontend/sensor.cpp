@@ -0,0 +1,57 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "sensor.h"
+#include "sensor_p.h"
+
+#include "soliddefs_p.h"
+#include <solid/devices/ifaces/sensor.h>
+
+Solid::Sensor::Sensor(QObject *backendObject)
+    : DeviceInterface(*new SensorPrivate(), backendObject)
+{
+}
+
+Solid::Sensor::~Sensor()
+{
+
+}
+
+QString Solid::Sensor::name() const
+{
+    Q_D(const Sensor);
+    return_SOLID_CALL(Ifaces::Sensor *, d->backendObject(), QString(), name());
+}
+
+double Solid::Sensor::temperature() const
+{
+    Q_FOREACH (const Reading &reading, readings()) {
+        if (reading.type == Temperature) {
+            return reading.value;
+        }
+    }
+    return 0;
+}
+
+Solid::Sensor::ReadingList Solid::Sensor::readings() const
+{
+    Q_D(const Sensor);
+    return_SOLID_CALL(Ifaces::Sensor *, d->backendObject(), ReadingList(), readings());
+}
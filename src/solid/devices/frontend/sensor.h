@@ -0,0 +1,142 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_SENSOR_H
+#define SOLID_SENSOR_H
+
+#include <QtCore/QList>
+
+#include <solid/solid_export.h>
+
+#include <solid/deviceinterface.h>
+
+namespace Solid
+{
+class SensorPrivate;
+class Device;
+
+/**
+ * This device interface is available on hardware monitoring chips and
+ * thermal zones. It gives access to their temperature, fan, voltage,
+ * current, power, energy and humidity readings.
+ *
+ * Processor thermal throttling is reported by the processors themselves,
+ * see Solid::Processor::coreThrottleCount(). Solid::SensorSampler reads
+ * both in one go.
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT Sensor : public DeviceInterface
+{
+    Q_OBJECT
+    Q_PROPERTY(QString name READ name)
+    Q_PROPERTY(double temperature READ temperature)
+    Q_DECLARE_PRIVATE(Sensor)
+    friend class Device;
+
+public:
+    /**
+     * This enum type defines the quantity a reading measures.
+     *
+     * - Temperature : a temperature in degrees Celsius
+     * - Fan : a fan speed in revolutions per minute
+     * - Voltage : a voltage in volts
+     * - Current : a current in amperes
+     * - Power : a power in watts
+     * - Energy : an energy in joules, accumulated since an arbitrary point
+     * - Humidity : a relative humidity in percent
+     */
+    enum ReadingType { Temperature, Fan, Voltage, Current, Power, Energy, Humidity };
+    Q_ENUM(ReadingType)
+
+    /**
+     * One channel of a sensor. The limits are those set in the chip or
+     * the firmware, they are 0 when unknown.
+     */
+    struct Reading {
+        Reading()
+            : type(Temperature), value(0), maximum(0), critical(0) {}
+
+        /// the channel label, e.g. "Package id 0" or "temp1" if the driver has none
+        QString label;
+        ReadingType type;
+        /// the current value, in the unit given by the type
+        double value;
+        double maximum;
+        double critical;
+    };
+    typedef QList<Reading> ReadingList;
+
+private:
+    /**
+     * Creates a new Sensor object.
+     * You generally won't need this. It's created when necessary using
+     * Device::as().
+     *
+     * @param backendObject the device interface object provided by the backend
+     * @see Solid::Device::as()
+     */
+    explicit Sensor(QObject *backendObject);
+
+public:
+    /**
+     * Destroys a Sensor object.
+     */
+    virtual ~Sensor();
+
+    /**
+     * Get the Solid::DeviceInterface::Type of the Sensor device interface.
+     *
+     * @return the Sensor device interface type
+     * @see Solid::Ifaces::Enums::DeviceInterface::Type
+     */
+    static Type deviceInterfaceType()
+    {
+        return DeviceInterface::Sensor;
+    }
+
+    /**
+     * Retrieves the name of the chip or thermal zone, e.g. "coretemp" or
+     * "acpitz".
+     *
+     * @return the sensor name
+     */
+    QString name() const;
+
+    /**
+     * Retrieves the first temperature reading of the sensor, which for
+     * processor sensors is usually the package temperature.
+     *
+     * @return the temperature in degrees Celsius, 0 if the sensor has no
+     * temperature channel
+     */
+    double temperature() const;
+
+    /**
+     * Retrieves the current value of every channel of the sensor. Backends
+     * keep the value files open, so this is cheap enough to be polled.
+     *
+     * @return the readings, in the order the channels are numbered
+     */
+    ReadingList readings() const;
+};
+}
+
+#endif
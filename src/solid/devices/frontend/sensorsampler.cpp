@@ -0,0 +1,149 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "sensorsampler.h"
+#include "sampler_p.h"
+
+#include <solid/processor.h>
+
+namespace Solid
+{
+class SensorSamplerPrivate : public SamplerPrivate
+{
+public:
+    struct ThrottleCounts {
+        qlonglong core;
+        qlonglong package;
+    };
+
+    SensorSamplerPrivate(SensorSampler *q, const QList<Device> &devices)
+        : SamplerPrivate(q, SLOT(collect()), devices, DeviceInterface::Sensor, 1000)
+    {
+        Q_FOREACH (const Device &device, devices) {
+            if (device.is<Processor>()) {
+                processors << device;
+            }
+        }
+    }
+
+    // the sensors are the sampled devices, processors report throttling
+    QList<Device> processors;
+    SampleHistory<ThrottleCounts> throttling;
+};
+}
+
+Solid::SensorSampler::SensorSampler(QObject *parent)
+    : QObject(parent),
+      d(new SensorSamplerPrivate(this, Device::listFromType(DeviceInterface::Sensor) + Device::listFromType(DeviceInterface::Processor)))
+{
+    qRegisterMetaType<Solid::SensorSampler::SampleList>();
+}
+
+Solid::SensorSampler::SensorSampler(const QList<Device> &devices, QObject *parent)
+    : QObject(parent),
+      d(new SensorSamplerPrivate(this, devices))
+{
+    qRegisterMetaType<Solid::SensorSampler::SampleList>();
+}
+
+Solid::SensorSampler::~SensorSampler()
+{
+    delete d;
+}
+
+int Solid::SensorSampler::interval() const
+{
+    return d->interval();
+}
+
+void Solid::SensorSampler::setInterval(int msec)
+{
+    d->setInterval(msec);
+}
+
+bool Solid::SensorSampler::isActive() const
+{
+    return d->isActive();
+}
+
+void Solid::SensorSampler::start()
+{
+    d->start();
+}
+
+void Solid::SensorSampler::stop()
+{
+    d->stop();
+}
+
+Solid::SensorSampler::SampleList Solid::SensorSampler::sample()
+{
+    SampleList samples;
+    samples.reserve(d->devices.size());
+
+    Q_FOREACH (const Device &device, d->devices) {
+        const Sensor *sensor = device.as<Sensor>();
+        if (!sensor) {
+            continue;
+        }
+
+        Sample sample;
+        sample.udi = device.udi();
+        sample.name = sensor->name();
+        sample.readings = sensor->readings();
+        samples << sample;
+    }
+
+    Q_FOREACH (const Device &device, d->processors) {
+        const Processor *processor = device.as<Processor>();
+        if (!processor) {
+            continue;
+        }
+
+        SensorSamplerPrivate::ThrottleCounts current;
+        current.core = processor->coreThrottleCount();
+        current.package = processor->packageThrottleCount();
+        if (current.core < 0 && current.package < 0) {
+            continue;
+        }
+
+        // the first sample is the baseline, throttling before it is history;
+        // the counters only go backwards when a processor went offline and came back
+        const QString udi = device.udi();
+        SensorSamplerPrivate::ThrottleCounts last;
+        qint64 elapsedNsecs;
+        if (!d->throttling.advance(udi, current, d->clock.nsecsElapsed(), &last, &elapsedNsecs)) {
+            continue;
+        }
+
+        const qulonglong coreEvents = counterDelta(current.core, last.core);
+        const qulonglong packageEvents = counterDelta(current.package, last.package);
+        if (coreEvents > 0 || packageEvents > 0) {
+            emit throttled(udi, coreEvents, packageEvents);
+        }
+    }
+
+    return samples;
+}
+
+void Solid::SensorSampler::collect()
+{
+    emit sampled(sample());
+}
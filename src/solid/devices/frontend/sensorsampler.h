@@ -0,0 +1,126 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_SENSORSAMPLER_H
+#define SOLID_SENSORSAMPLER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+#include <QtCore/QMetaType>
+
+#include <solid/solid_export.h>
+
+#include <solid/device.h>
+#include <solid/sensor.h>
+
+namespace Solid
+{
+class SensorSamplerPrivate;
+
+/**
+ * Periodically reads a set of sensors and watches the thermal throttling
+ * counters of the processors.
+ *
+ * All sensors are read in one go on every tick and reported through a
+ * single sampled() signal. In the same tick the throttling counters of the
+ * processors are compared with the previous tick, and throttled() is
+ * emitted for every processor whose counters went up, which allows to tell
+ * whether a slowdown coincided with a thermal event.
+ *
+ * @since 5.37
+ */
+class SOLID_EXPORT SensorSampler : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int interval READ interval WRITE setInterval)
+    Q_PROPERTY(bool active READ isActive)
+
+public:
+    /**
+     * The readings of one sensor.
+     */
+    struct Sample {
+        QString udi;
+        QString name;
+        Sensor::ReadingList readings;
+    };
+    typedef QList<Sample> SampleList;
+
+    /**
+     * Creates a sampler for all sensors and processors of the system.
+     */
+    explicit SensorSampler(QObject *parent = nullptr);
+
+    /**
+     * Creates a sampler for the given devices. Sensor devices are read,
+     * Processor devices are watched for throttling, other devices are
+     * ignored.
+     */
+    explicit SensorSampler(const QList<Device> &devices, QObject *parent = nullptr);
+
+    ~SensorSampler();
+
+    /**
+     * @return the sampling interval in milliseconds, 1000 by default
+     */
+    int interval() const;
+    void setInterval(int msec);
+
+    bool isActive() const;
+
+    /**
+     * Reads all sensors right away, without emitting sampled(). The
+     * throttling counters are checked as well, so throttled() may be
+     * emitted before this returns.
+     */
+    SampleList sample();
+
+public Q_SLOTS:
+    void start();
+    void stop();
+
+Q_SIGNALS:
+    /**
+     * Emitted once per interval with the readings of every sensor.
+     */
+    void sampled(const Solid::SensorSampler::SampleList &samples);
+
+    /**
+     * Emitted when a processor got throttled since the previous sample.
+     * Package throttling is reported by every processor of the package.
+     *
+     * @param udi the udi of the processor
+     * @param coreEvents the number of new core throttling events
+     * @param packageEvents the number of new package throttling events
+     */
+    void throttled(const QString &udi, qulonglong coreEvents, qulonglong packageEvents);
+
+private Q_SLOTS:
+    void collect();
+
+private:
+    SensorSamplerPrivate *const d;
+};
+}
+
+Q_DECLARE_METATYPE(Solid::SensorSampler::Sample)
+Q_DECLARE_METATYPE(Solid::SensorSampler::SampleList)
+
+#endif
@@ -90,3 +90,36 @@ bool Solid::StorageDrive::isInUse() const
     return inUse;
 }
 
+double Solid::StorageDrive::pcieLinkSpeed() const
+{
+    Q_D(const StorageDrive);
+    return_SOLID_CALL(Ifaces::StorageDrive *, d->backendObject(), 0, pcieLinkSpeed());
+}
+
+int Solid::StorageDrive::pcieLinkWidth() const
+{
+    Q_D(const StorageDrive);
+    return_SOLID_CALL(Ifaces::StorageDrive *, d->backendObject(), 0, pcieLinkWidth());
+}
+
+double Solid::StorageDrive::maxPcieLinkSpeed() const
+{
+    Q_D(const StorageDrive);
+    return_SOLID_CALL(Ifaces::StorageDrive *, d->backendObject(), 0, maxPcieLinkSpeed());
+}
+
+int Solid::StorageDrive::maxPcieLinkWidth() const
+{
+    Q_D(const StorageDrive);
+    return_SOLID_CALL(Ifaces::StorageDrive *, d->backendObject(), 0, maxPcieLinkWidth());
+}
+
+bool Solid::StorageDrive::isPcieLinkDegraded() const
+{
+    const double speed = pcieLinkSpeed();
+    const int width = pcieLinkWidth();
+    if (speed <= 0 || width <= 0) {
+        return false;
+    }
+    return speed < maxPcieLinkSpeed() || width < maxPcieLinkWidth();
+}
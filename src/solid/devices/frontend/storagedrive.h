@@ -45,6 +45,11 @@ class SOLID_EXPORT StorageDrive : public DeviceInterface
     Q_PROPERTY(bool hotpluggable READ isHotpluggable)
     Q_PROPERTY(bool inUse READ isInUse)
     Q_PROPERTY(qulonglong size READ size)
+    Q_PROPERTY(double pcieLinkSpeed READ pcieLinkSpeed)
+    Q_PROPERTY(int pcieLinkWidth READ pcieLinkWidth)
+    Q_PROPERTY(double maxPcieLinkSpeed READ maxPcieLinkSpeed)
+    Q_PROPERTY(int maxPcieLinkWidth READ maxPcieLinkWidth)
+    Q_PROPERTY(bool pcieLinkDegraded READ isPcieLinkDegraded)
     Q_DECLARE_PRIVATE(StorageDrive)
     friend class Device;
 
@@ -157,6 +162,53 @@ public:
      */
     bool isInUse() const;
 
+    /**
+     * Retrieves the negotiated transfer rate of the PCI Express link the
+     * drive sits on, e.g. 8.0 for a PCIe 3.0 link.
+     *
+     * @return the transfer rate in GT/s, 0 if the drive isn't behind a
+     * PCI Express link
+     * @since 5.37
+     */
+    double pcieLinkSpeed() const;
+
+    /**
+     * Retrieves the negotiated number of lanes of the PCI Express link.
+     *
+     * @return the link width, 0 if unknown
+     * @since 5.37
+     */
+    int pcieLinkWidth() const;
+
+    /**
+     * Retrieves the highest transfer rate supported by both ends of the
+     * PCI Express link.
+     *
+     * @return the transfer rate in GT/s, 0 if unknown
+     * @since 5.37
+     */
+    double maxPcieLinkSpeed() const;
+
+    /**
+     * Retrieves the highest number of lanes supported by both ends of the
+     * PCI Express link.
+     *
+     * @return the link width, 0 if unknown
+     * @since 5.37
+     */
+    int maxPcieLinkWidth() const;
+
+    /**
+     * Indicates if the PCI Express link trained below what both of its
+     * ends support, for instance x4 instead of x8 or 8 GT/s instead of
+     * 16 GT/s, which caps the throughput of the drive. Note that some
+     * devices lower their link speed while idle to save power.
+     *
+     * @return true if the negotiated speed or width is below the maximum
+     * @since 5.37
+     */
+    bool isPcieLinkDegraded() const;
+
 protected:
     /**
      * @internal
@@ -22,6 +22,7 @@
 #define SOLID_IFACES_BLOCK_H
 
 #include <solid/devices/ifaces/deviceinterface.h>
+#include <solid/block.h>
 
 namespace Solid
 {
@@ -66,6 +67,70 @@ public:
      * the device
      */
     virtual QString device() const = 0;
+
+    /**
+     * Retrieves the I/O counters of the device.
+     *
+     * @return the current I/O counters
+     */
+    virtual Solid::Block::IoStatistics ioStatistics() const = 0;
+
+    /**
+     * Indicates if the device has rotating media.
+     *
+     * @return true if the device is rotational
+     */
+    virtual bool isRotational() const = 0;
+
+    /**
+     * Retrieves the logical block size in bytes.
+     */
+    virtual int logicalBlockSize() const = 0;
+
+    /**
+     * Retrieves the physical block size in bytes.
+     */
+    virtual int physicalBlockSize() const = 0;
+
+    /**
+     * Retrieves the preferred minimum request size in bytes.
+     */
+    virtual int minimumIoSize() const = 0;
+
+    /**
+     * Retrieves the preferred size for sustained I/O in bytes.
+     */
+    virtual int optimalIoSize() const = 0;
+
+    /**
+     * Retrieves the discard granularity in bytes.
+     */
+    virtual int discardGranularity() const = 0;
+
+    /**
+     * Retrieves the zoned block device model.
+     */
+    virtual Solid::Block::ZonedModel zonedModel() const = 0;
+
+    /**
+     * Retrieves the name of the active I/O scheduler.
+     */
+    virtual QString scheduler() const = 0;
+
+    /**
+     * Retrieves the size of the request queue.
+     */
+    virtual int requestQueueSize() const = 0;
+
+    /**
+     * Retrieves the read-ahead size in KiB.
+     */
+    virtual int readAheadSize() const = 0;
+
+    /**
+     * Retrieves the number of hardware queues.
+     */
+    virtual int hardwareQueueCount() const = 0;
 };
 }
 }
@@ -0,0 +1,73 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_IFACES_ENERGYCOUNTER_H
+#define SOLID_IFACES_ENERGYCOUNTER_H
+
+#include <solid/energycounter.h>
+#include <solid/devices/ifaces/deviceinterface.h>
+
+namespace Solid
+{
+namespace Ifaces
+{
+/**
+ * This device interface is available on energy counters.
+ */
+class EnergyCounter : virtual public DeviceInterface
+{
+public:
+    /**
+     * Destroys an EnergyCounter object.
+     */
+    virtual ~EnergyCounter();
+
+    /**
+     * Retrieves the name of the counter.
+     */
+    virtual QString name() const = 0;
+
+    /**
+     * Retrieves the part of the system the counter measures.
+     */
+    virtual Solid::EnergyCounter::Domain domain() const = 0;
+
+    /**
+     * Retrieves the wrap value of the hardware counter in microjoules.
+     */
+    virtual qulonglong maxEnergyRange() const = 0;
+
+    /**
+     * Retrieves the energy consumed so far in microjoules, read live and
+     * corrected for wraparounds of the hardware counter.
+     */
+    virtual qulonglong energy() const = 0;
+
+    /**
+     * Indicates if the counter can be read by this process.
+     */
+    virtual bool isReadable() const = 0;
+};
+}
+}
+
+Q_DECLARE_INTERFACE(Solid::Ifaces::EnergyCounter, "org.kde.Solid.Ifaces.EnergyCounter/0.1")
+
+#endif
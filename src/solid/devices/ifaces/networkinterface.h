@@ -0,0 +1,124 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_IFACES_NETWORKINTERFACE_H
+#define SOLID_IFACES_NETWORKINTERFACE_H
+
+#include <solid/networkinterface.h>
+#include <solid/devices/ifaces/deviceinterface.h>
+
+namespace Solid
+{
+namespace Ifaces
+{
+/**
+ * This device interface is available on network interfaces.
+ */
+class NetworkInterface : virtual public DeviceInterface
+{
+public:
+    /**
+     * Destroys a NetworkInterface object.
+     */
+    virtual ~NetworkInterface();
+
+    /**
+     * Retrieves the name of the interface.
+     */
+    virtual QString interfaceName() const = 0;
+
+    /**
+     * Retrieves the link layer address of the interface.
+     */
+    virtual QString hardwareAddress() const = 0;
+
+    /**
+     * Indicates if this is a wireless interface.
+     */
+    virtual bool isWireless() const = 0;
+
+    /**
+     * Retrieves the negotiated link speed in Mbit/s, -1 if unknown.
+     */
+    virtual int speed() const = 0;
+
+    /**
+     * Retrieves the negotiated duplex mode.
+     */
+    virtual Solid::NetworkInterface::Duplex duplex() const = 0;
+
+    /**
+     * Retrieves the maximum transmission unit in bytes.
+     */
+    virtual int mtu() const = 0;
+
+    /**
+     * Indicates if the physical link is up.
+     */
+    virtual bool hasCarrier() const = 0;
+
+    /**
+     * Retrieves the operational state of the interface.
+     */
+    virtual Solid::NetworkInterface::OperationalState operationalState() const = 0;
+
+    /**
+     * Retrieves the number of receive queues.
+     */
+    virtual int rxQueueCount() const = 0;
+
+    /**
+     * Retrieves the number of transmit queues.
+     */
+    virtual int txQueueCount() const = 0;
+
+    /**
+     * Retrieves the traffic counters of the interface.
+     */
+    virtual Solid::NetworkInterface::Statistics statistics() const = 0;
+
+    /**
+     * Retrieves the negotiated transfer rate in GT/s of the PCI Express
+     * link the device sits on, read live; 0 if unknown.
+     */
+    virtual double pcieLinkSpeed() const = 0;
+
+    /**
+     * Retrieves the negotiated width of the PCI Express link, read live.
+     */
+    virtual int pcieLinkWidth() const = 0;
+
+    /**
+     * Retrieves the highest transfer rate in GT/s both ends of the PCI Express
+     * link support.
+     */
+    virtual double maxPcieLinkSpeed() const = 0;
+
+    /**
+     * Retrieves the highest width both ends of the PCI Express link support.
+     */
+    virtual int maxPcieLinkWidth() const = 0;
+};
+}
+}
+
+Q_DECLARE_INTERFACE(Solid::Ifaces::NetworkInterface, "org.kde.Solid.Ifaces.NetworkInterface/0.1")
+
+#endif
@@ -0,0 +1,98 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_IFACES_NUMANODE_H
+#define SOLID_IFACES_NUMANODE_H
+
+#include <solid/numanode.h>
+#include <solid/devices/ifaces/deviceinterface.h>
+
+namespace Solid
+{
+namespace Ifaces
+{
+/**
+ * This device interface is available on NUMA memory nodes.
+ */
+class NumaNode : virtual public DeviceInterface
+{
+public:
+    /**
+     * Destroys a NumaNode object.
+     */
+    virtual ~NumaNode();
+
+    /**
+     * Retrieves the number of the node.
+     */
+    virtual int number() const = 0;
+
+    /**
+     * Retrieves the processors local to the node, in list format.
+     */
+    virtual QString cpuList() const = 0;
+
+    /**
+     * Retrieves the distances to every node, indexed by node number.
+     */
+    virtual QList<int> distances() const = 0;
+
+    /**
+     * Retrieves the memory of the node in bytes, read live.
+     */
+    virtual qulonglong totalMemory() const = 0;
+
+    /**
+     * Retrieves the free memory of the node in bytes, read live.
+     */
+    virtual qulonglong freeMemory() const = 0;
+
+    /**
+     * Retrieves the huge page pools of the node sorted by page size, read
+     * live.
+     */
+    virtual Solid::NumaNode::HugePagePoolList hugePagePools() const = 0;
+
+    /**
+     * Retrieves the number of memory blocks of the node.
+     */
+    virtual int memoryBlockCount() const = 0;
+
+    /**
+     * Retrieves the number of online memory blocks of the node.
+     */
+    virtual int onlineMemoryBlockCount() const = 0;
+
+protected:
+    //Q_SIGNALS:
+    /**
+     * This signal is emitted when a huge page pool of the node changed.
+     * Backends only need to watch the pools while the signal is connected.
+     *
+     * @param udi the UDI of the node
+     */
+    virtual void hugePagesChanged(const QString &udi) = 0;
+};
+}
+}
+
+Q_DECLARE_INTERFACE(Solid::Ifaces::NumaNode, "org.kde.Solid.Ifaces.NumaNode/0.1")
+
+#endif
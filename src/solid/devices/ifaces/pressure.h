@@ -0,0 +1,82 @@
+/*
+    Copyright 2026 Solid developers
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) version 3, or any
+    later version accepted by the membership of KDE e.V. (or its
+    successor approved by the membership of KDE e.V.), which shall
+    act as a proxy defined in Section 6 of version 3 of the license.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOLID_IFACES_PRESSURE_H
+#define SOLID_IFACES_PRESSURE_H
+
+#include <solid/pressure.h>
+#include <solid/devices/ifaces/deviceinterface.h>
+
+namespace Solid
+{
+namespace Ifaces
+{
+/**
+ * This device interface is available on the pressure stall information of
+ * a resource.
+ */
+class Pressure : virtual public DeviceInterface
+{
+public:
+    /**
+     * Destroys a Pressure object.
+     */
+    virtual ~Pressure();
+
+    /**
+     * Retrieves the resource the pressure is reported for.
+     */
+    virtual Solid::Pressure::Resource resource() const = 0;
+
+    /**
+     * Retrieves the current figures of a stall type, read live.
+     */
+    virtual Solid::Pressure::Stall stall(Solid::Pressure::StallType type) const = 0;
+
+    /**
+     * Registers a trigger on the stall time within a window, both in
+     * microseconds. Backends should let the kernel signal the trigger
+     * rather than poll.
+     *
+     * @return the trigger identifier, or -1 on failure
+     */
+    virtual int addTrigger(Solid::Pressure::StallType type, qulonglong threshold, qulonglong window) = 0;
+
+    /**
+     * Unregisters a trigger returned by addTrigger().
+     */
+    virtual void removeTrigger(int id) = 0;
+
+protected:
+    //Q_SIGNALS:
+    /**
+     * This signal is emitted when the threshold of a trigger was exceeded.
+     *
+     * @param id the identifier of the trigger
+     * @param udi the UDI of the pressure device
+     */
+    virtual void triggered(int id, const QString &udi) = 0;
+};
+}
+}
+
+Q_DECLARE_INTERFACE(Solid::Ifaces::Pressure, "org.kde.Solid.Ifaces.Pressure/0.1")
+
+#endif
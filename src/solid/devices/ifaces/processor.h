@@ -70,6 +70,106 @@ public:
      */
     virtual Solid::Processor::InstructionSets instructionSets() const = 0;
 
+    /**
+     * Retrieves the physical package (socket) the processor belongs to.
+     *
+     * @return the package id, or -1 if unknown
+     */
+    virtual int packageId() const = 0;
+
+    /**
+     * Retrieves the die within its package the processor belongs to.
+     *
+     * @return the die id, or -1 if unknown
+     */
+    virtual int dieId() const = 0;
+
+    /**
+     * Retrieves the core within its package the processor belongs to.
+     *
+     * @return the core id, or -1 if unknown
+     */
+    virtual int coreId() const = 0;
+
+    /**
+     * Retrieves the position of this logical processor among the hardware
+     * threads of its core.
+     *
+     * @return the thread index, or -1 if unknown
+     */
+    virtual int threadId() const = 0;
+
+    /**
+     * Retrieves the NUMA node the processor belongs to.
+     *
+     * @return the NUMA node number, or -1 if unknown
+     */
+    virtual int numaNode() const = 0;
+
+    /**
+     * Retrieves the logical processors sharing this processor's core.
+     *
+     * @return a cpu list, or an empty string if unknown
+     */
+    virtual QString threadSiblings() const = 0;
+
+    /**
+     * Retrieves the logical processors sharing this processor's package.
+     *
+     * @return a cpu list, or an empty string if unknown
+     */
+    virtual QString packageSiblings() const = 0;
+
+    /**
+     * Retrieves the caches the processor has access to.
+     *
+     * @return the caches ordered by level, or an empty list if unknown
+     */
+    virtual Solid::Processor::CacheList caches() const = 0;
+
+    /**
+     * Retrieves the current speed of the processor, read live.
+     *
+     * @return the current speed in MHz, or 0 if unknown
+     */
+    virtual int currentSpeed() const = 0;
+
+    /**
+     * Retrieves the frequency scaling governor driving the processor.
+     *
+     * @return the governor name, or an empty string if unknown
+     */
+    virtual QString governor() const = 0;
+
+    /**
+     * Retrieves the energy/performance preference hint of the processor.
+     *
+     * @return the preference, or an empty string if unknown
+     */
+    virtual QString energyPerformancePreference() const = 0;
+
+    /**
+     * Retrieves the idle states of the processor and their usage, read live.
+     *
+     * @return the idle states from the shallowest to the deepest one
+     */
+    virtual Solid::Processor::IdleStateList idleStates() const = 0;
+
+    /**
+     * Retrieves the number of thermal throttling events of the core, read
+     * live.
+     *
+     * @return the number of events, -1 if unknown
+     */
+    virtual qlonglong coreThrottleCount() const = 0;
+
+    /**
+     * Retrieves the number of thermal throttling events of the package,
+     * read live.
+     *
+     * @return the number of events, -1 if unknown
+     */
+    virtual qlonglong packageThrottleCount() const = 0;
 };
 }
 }
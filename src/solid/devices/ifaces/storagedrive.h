@@ -83,6 +83,28 @@ public:
     * @return the size of this drive
     */
     virtual qulonglong size() const = 0;
+
+    /**
+     * Retrieves the negotiated transfer rate in GT/s of the PCI Express
+     * link the device sits on, read live; 0 if unknown.
+     */
+    virtual double pcieLinkSpeed() const = 0;
+
+    /**
+     * Retrieves the negotiated width of the PCI Express link, read live.
+     */
+    virtual int pcieLinkWidth() const = 0;
+
+    /**
+     * Retrieves the highest transfer rate in GT/s both ends of the PCI Express
+     * link support.
+     */
+    virtual double maxPcieLinkSpeed() const = 0;
+
+    /**
+     * Retrieves the highest width both ends of the PCI Express link support.
+     */
+    virtual int maxPcieLinkWidth() const = 0;
 };
 }
 }